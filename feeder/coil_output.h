@@ -0,0 +1,101 @@
+#ifndef COIL_OUTPUT_H
+#define COIL_OUTPUT_H
+
+#include <Arduino.h>
+#include <driver/gpio.h>
+#include <soc/gpio_struct.h>
+
+#define COIL_PHASE_COUNT 4   // Full steps before the coil pattern repeats
+
+// Coil pattern of each full step phase, bit i drives coil pin i (AccelStepper::step4 order)
+constexpr uint8_t fullStepPattern(int phase) {
+    return phase == 0 ? 0b0101 : phase == 1 ? 0b0110 : phase == 2 ? 0b1010 : 0b1001;
+}
+
+// How a StepGenerator reaches its coils
+typedef struct {
+    void (*begin)();              // Make the coil pins outputs
+    void (*write)(uint8_t phase); // Drive the coils for a full step phase, from the step ISR
+} CoilDriver;
+
+// Coil outputs written straight to the GPIO set/clear registers. The pins
+// are GPIO numbers, not Arduino pin numbers (on the Nano ESP32 D8-D11 are
+// GPIO 17, 18, 21 and 38), so the set and clear mask of every phase is a
+// compile-time constant and a phase change is one clear and one set store
+// per register bank - pins 32 and up live in the second bank. All coils of a
+// bank switch on the same store, instead of one digitalWrite() per coil.
+// Use CoilOutput<GPIO1, GPIO2, GPIO3, GPIO4>::driver for a StepGenerator.
+template <int G1, int G2, int G3, int G4>
+class CoilOutput {
+    static_assert(G1 >= 0 && G1 < 64 && G2 >= 0 && G2 < 64 && G3 >= 0 && G3 < 64 && G4 >= 0 && G4 < 64,
+                  "Coil pins are GPIO numbers");
+
+private:
+    static constexpr uint32_t bank0(int gpio) { return gpio < 32 ? 1UL << gpio : 0; }
+    static constexpr uint32_t bank1(int gpio) { return gpio >= 32 ? 1UL << (gpio - 32) : 0; }
+
+    // Pins of the coils selected by bits, in one register bank
+    static constexpr uint32_t mask0(uint8_t bits) {
+        return ((bits & 1) ? bank0(G1) : 0) | ((bits & 2) ? bank0(G2) : 0) |
+               ((bits & 4) ? bank0(G3) : 0) | ((bits & 8) ? bank0(G4) : 0);
+    }
+    static constexpr uint32_t mask1(uint8_t bits) {
+        return ((bits & 1) ? bank1(G1) : 0) | ((bits & 2) ? bank1(G2) : 0) |
+               ((bits & 4) ? bank1(G3) : 0) | ((bits & 8) ? bank1(G4) : 0);
+    }
+    static constexpr uint8_t offBits(int phase) { return (uint8_t)(~fullStepPattern(phase) & 0x0F); }
+
+    static constexpr bool usesBank1 = mask1(0x0F) != 0;
+
+    static constexpr uint32_t set0[COIL_PHASE_COUNT] = {
+        mask0(fullStepPattern(0)), mask0(fullStepPattern(1)), mask0(fullStepPattern(2)), mask0(fullStepPattern(3)),
+    };
+    static constexpr uint32_t clear0[COIL_PHASE_COUNT] = {
+        mask0(offBits(0)), mask0(offBits(1)), mask0(offBits(2)), mask0(offBits(3)),
+    };
+    static constexpr uint32_t set1[COIL_PHASE_COUNT] = {
+        mask1(fullStepPattern(0)), mask1(fullStepPattern(1)), mask1(fullStepPattern(2)), mask1(fullStepPattern(3)),
+    };
+    static constexpr uint32_t clear1[COIL_PHASE_COUNT] = {
+        mask1(offBits(0)), mask1(offBits(1)), mask1(offBits(2)), mask1(offBits(3)),
+    };
+
+public:
+    static void begin() {
+        gpio_config_t config = {};
+        config.pin_bit_mask = (1ULL << G1) | (1ULL << G2) | (1ULL << G3) | (1ULL << G4);
+        config.mode = GPIO_MODE_OUTPUT;
+        config.pull_up_en = GPIO_PULLUP_DISABLE;
+        config.pull_down_en = GPIO_PULLDOWN_DISABLE;
+        config.intr_type = GPIO_INTR_DISABLE;
+        gpio_config(&config);
+    }
+
+    // Clear before set, so two coils of a bridge are never driven from opposite steps at once
+    static void IRAM_ATTR write(uint8_t phase) {
+        phase &= COIL_PHASE_COUNT - 1;
+        GPIO.out_w1tc = clear0[phase];
+        GPIO.out_w1ts = set0[phase];
+        if (usesBank1) {
+            GPIO.out1_w1tc.val = clear1[phase];
+            GPIO.out1_w1ts.val = set1[phase];
+        }
+    }
+
+    static const CoilDriver driver;
+};
+
+template <int G1, int G2, int G3, int G4>
+constexpr uint32_t CoilOutput<G1, G2, G3, G4>::set0[COIL_PHASE_COUNT];
+template <int G1, int G2, int G3, int G4>
+constexpr uint32_t CoilOutput<G1, G2, G3, G4>::clear0[COIL_PHASE_COUNT];
+template <int G1, int G2, int G3, int G4>
+constexpr uint32_t CoilOutput<G1, G2, G3, G4>::set1[COIL_PHASE_COUNT];
+template <int G1, int G2, int G3, int G4>
+constexpr uint32_t CoilOutput<G1, G2, G3, G4>::clear1[COIL_PHASE_COUNT];
+template <int G1, int G2, int G3, int G4>
+constexpr bool CoilOutput<G1, G2, G3, G4>::usesBank1;
+template <int G1, int G2, int G3, int G4>
+const CoilDriver CoilOutput<G1, G2, G3, G4>::driver = { &CoilOutput::begin, &CoilOutput::write };
+
+#endif //COIL_OUTPUT_H
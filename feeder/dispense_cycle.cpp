@@ -0,0 +1,83 @@
+#include "dispense_cycle.h"
+
+DispenseCycle::DispenseCycle(StepGenerator& motor, int forwardSteps, int backwardSteps, int8_t feedDirection)
+    : motor(motor), forwardSteps(forwardSteps), backwardSteps(backwardSteps), feedDirection(feedDirection),
+      phase(DISPENSE_IDLE), paused(false), startPosition(0), phaseTarget(0), targetSteps(0), cycleCount(0) {
+}
+
+bool DispenseCycle::start(long netSteps) {
+    if (phase != DISPENSE_IDLE || motor.isRunning()) {
+        return false;
+    }
+    startPosition = motor.currentPosition();
+    targetSteps = netSteps;
+    cycleCount = 0;
+    paused = false;
+    beginPhase(DISPENSE_FORWARD);
+    return true;
+}
+
+void DispenseCycle::beginPhase(DispensePhase next) {
+    phase = next;
+    long steps = next == DISPENSE_FORWARD ? forwardSteps : -backwardSteps;
+    phaseTarget = motor.currentPosition() + steps * feedDirection;
+    motor.moveTo(phaseTarget);
+}
+
+void DispenseCycle::pause() {
+    if (phase == DISPENSE_FORWARD || phase == DISPENSE_BACKWARD) {
+        paused = true;
+        motor.stop();
+    }
+}
+
+void DispenseCycle::resume() {
+    paused = false;
+}
+
+void DispenseCycle::cancel() {
+    if (phase != DISPENSE_IDLE) {
+        phase = DISPENSE_STOPPING;
+        paused = false;
+        motor.stop();
+    }
+}
+
+bool DispenseCycle::tick() {
+    if (phase == DISPENSE_IDLE || motor.isRunning()) {
+        return false;
+    }
+
+    if (phase == DISPENSE_STOPPING) {
+        phase = DISPENSE_IDLE;
+        return true;
+    }
+
+    if (paused) {
+        return false;
+    }
+
+    // Stopped short by a pause, finish the phase first
+    if (motor.currentPosition() != phaseTarget) {
+        motor.moveTo(phaseTarget);
+        return false;
+    }
+
+    if (phase == DISPENSE_FORWARD) {
+        beginPhase(DISPENSE_BACKWARD);
+        return false;
+    }
+
+    // Backward done, one full cycle
+    cycleCount++;
+    if (targetSteps > 0 && dispensedSteps() >= targetSteps) {
+        phase = DISPENSE_IDLE;
+        return true;
+    }
+    beginPhase(DISPENSE_FORWARD);
+    return false;
+}
+
+long DispenseCycle::dispensedSteps() const {
+    return (motor.currentPosition() - startPosition) * feedDirection;
+}
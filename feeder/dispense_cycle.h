@@ -0,0 +1,62 @@
+#ifndef DISPENSE_CYCLE_H
+#define DISPENSE_CYCLE_H
+
+#include <Arduino.h>
+#include "step_generator.h"
+
+enum DispensePhase {
+    DISPENSE_IDLE,
+    DISPENSE_FORWARD,    // Turning the auger to push food out
+    DISPENSE_BACKWARD,   // Turning back a little to clear a jam
+    DISPENSE_STOPPING    // Cancelled, waiting for the motor to stop
+};
+
+// Anti-jam dispensing: forward a little, back a little, until enough food
+// has been pushed out. The motor moves in the background (StepGenerator),
+// tick() only starts the next phase once the previous one is done, so a
+// dispense never blocks loop(). Progress is counted from the motor position,
+// so pausing or cancelling mid-phase keeps the step count exact, and resume()
+// finishes the interrupted phase where it stopped.
+class DispenseCycle {
+private:
+    StepGenerator& motor;
+    const int forwardSteps;
+    const int backwardSteps;
+    const int8_t feedDirection;   // Motor direction that pushes food out
+
+    DispensePhase phase;
+    bool paused;
+    long startPosition;           // Motor position when the dispense started
+    long phaseTarget;             // Motor position that ends the current phase
+    long targetSteps;             // Net steps to dispense, 0 until cancelled
+    uint32_t cycleCount;          // Completed forward/backward cycles
+
+    void beginPhase(DispensePhase next);
+
+public:
+    DispenseCycle(StepGenerator& motor, int forwardSteps, int backwardSteps, int8_t feedDirection);
+
+    // Dispense netSteps (whole cycles, so possibly a little more), or until
+    // cancelled if netSteps is 0. Returns false if a dispense is running.
+    bool start(long netSteps);
+
+    // Decelerate and hold, resume() continues the interrupted phase
+    void pause();
+    void resume();
+
+    // Decelerate and end the dispense, tick() reports when the motor stopped
+    void cancel();
+
+    // Start the next phase when the current one is done, call from loop().
+    // Returns true once, when the dispense has finished or was cancelled.
+    bool tick();
+
+    bool isActive() const { return phase != DISPENSE_IDLE; }
+    bool isPaused() const { return paused; }
+    DispensePhase currentPhase() const { return phase; }
+    long dispensedSteps() const;   // Net steps pushed out by the current or last dispense
+    long target() const { return targetSteps; }
+    uint32_t cycles() const { return cycleCount; }
+};
+
+#endif //DISPENSE_CYCLE_H
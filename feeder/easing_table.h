@@ -0,0 +1,109 @@
+#ifndef EASING_TABLE_H
+#define EASING_TABLE_H
+
+#include <stdint.h>
+
+// Compile-time motion profiles for the lid servo.
+// Each profile maps normalized time to normalized position, both 0..1. The
+// tables are generated by the compiler and evaluated with integers only:
+// time and position are Q16 fixed point (65536 = 1.0 for time, 65535 = 1.0
+// for position), values between table entries are interpolated linearly.
+
+#define EASING_SEGMENTS_LOG2 6                          // 64 segments per profile
+#define EASING_SEGMENTS (1 << EASING_SEGMENTS_LOG2)
+#define EASING_FRACTION_BITS (16 - EASING_SEGMENTS_LOG2) // Time bits interpolated within a segment
+#define EASING_ONE 65536                                // Q16 time of the end of a move
+#define EASING_TRAPEZOID_RAMP 0.25                      // Share of the move spent accelerating (and decelerating)
+
+enum EasingProfile {
+    EASE_QUADRATIC,   // Ease in and out, the original smoothServoMove curve
+    EASE_CUBIC,       // Cubic S-curve (smoothstep), zero velocity at both ends
+    EASE_TRAPEZOID,   // Constant acceleration, cruise, constant deceleration
+    EASE_MIN_JERK,    // Minimum jerk, zero velocity and acceleration at both ends - the gentlest start
+    EASE_PROFILE_COUNT
+};
+
+// Exact profiles, also used at compile time to fill the tables
+constexpr double easeQuadratic(double s) {
+    return s < 0.5 ? 2 * s * s : 1 - 2 * (1 - s) * (1 - s);
+}
+
+constexpr double easeCubic(double s) {
+    return s * s * (3 - 2 * s);
+}
+
+constexpr double easeTrapezoid(double s) {
+    // Peak velocity 1 / (1 - ramp), reached after the ramp
+    return s < EASING_TRAPEZOID_RAMP
+               ? s * s / (2 * EASING_TRAPEZOID_RAMP * (1 - EASING_TRAPEZOID_RAMP))
+               : s <= 1 - EASING_TRAPEZOID_RAMP
+                     ? (s - EASING_TRAPEZOID_RAMP / 2) / (1 - EASING_TRAPEZOID_RAMP)
+                     : 1 - (1 - s) * (1 - s) / (2 * EASING_TRAPEZOID_RAMP * (1 - EASING_TRAPEZOID_RAMP));
+}
+
+constexpr double easeMinJerk(double s) {
+    return s * s * s * (10 + s * (-15 + 6 * s));
+}
+
+constexpr double easeExact(EasingProfile profile, double s) {
+    return profile == EASE_QUADRATIC ? easeQuadratic(s)
+         : profile == EASE_CUBIC ? easeCubic(s)
+         : profile == EASE_TRAPEZOID ? easeTrapezoid(s)
+         : easeMinJerk(s);
+}
+
+// Table entry i of a profile, rounded to Q16
+constexpr uint16_t easingEntry(EasingProfile profile, int i) {
+    return (uint16_t)(easeExact(profile, (double)i / EASING_SEGMENTS) * 65535 + 0.5);
+}
+
+// Expands to one table row per profile, EASING_SEGMENTS + 1 entries each
+template <int... I>
+struct EasingIndices {};
+
+template <int N, int... I>
+struct MakeEasingIndices : MakeEasingIndices<N - 1, N - 1, I...> {};
+
+template <int... I>
+struct MakeEasingIndices<0, I...> {
+    typedef EasingIndices<I...> type;
+};
+
+template <typename Indices>
+struct EasingTables;
+
+template <int... I>
+struct EasingTables<EasingIndices<I...> > {
+    static constexpr uint16_t table[EASE_PROFILE_COUNT][EASING_SEGMENTS + 1] = {
+        { easingEntry(EASE_QUADRATIC, I)... },
+        { easingEntry(EASE_CUBIC, I)... },
+        { easingEntry(EASE_TRAPEZOID, I)... },
+        { easingEntry(EASE_MIN_JERK, I)... },
+    };
+};
+
+template <int... I>
+constexpr uint16_t EasingTables<EasingIndices<I...> >::table[EASE_PROFILE_COUNT][EASING_SEGMENTS + 1];
+
+typedef EasingTables<MakeEasingIndices<EASING_SEGMENTS + 1>::type> Easing;
+
+static_assert(Easing::table[EASE_QUADRATIC][0] == 0 && Easing::table[EASE_QUADRATIC][EASING_SEGMENTS] == 65535,
+              "Profiles must start at 0 and end at 1");
+static_assert(Easing::table[EASE_TRAPEZOID][EASING_SEGMENTS / 2] == 32768 &&
+              Easing::table[EASE_MIN_JERK][EASING_SEGMENTS / 2] == 32768,
+              "Profiles are symmetric around the middle of the move");
+
+// Position (Q16, 0..65535) at time t (Q16, 0..EASING_ONE) along profile
+inline uint16_t easeFixed(EasingProfile profile, uint32_t t) {
+    if (t >= EASING_ONE) {
+        return 65535;
+    }
+    const uint16_t* row = Easing::table[profile];
+    uint32_t segment = t >> EASING_FRACTION_BITS;
+    int32_t fraction = t & ((1 << EASING_FRACTION_BITS) - 1);
+    int32_t from = row[segment];
+    int32_t to = row[segment + 1];
+    return (uint16_t)(from + (((to - from) * fraction) >> EASING_FRACTION_BITS));
+}
+
+#endif //EASING_TABLE_H
@@ -0,0 +1,90 @@
+#ifndef EDGE_RING_H
+#define EDGE_RING_H
+
+#include <Arduino.h>
+#include <atomic>
+
+#define EDGE_RING_SIZE 128       // Captured edges buffered between ISR and loop (power of two)
+#define FRAME_END_RING_SIZE 8    // Closed frames waiting to be decoded (power of two)
+
+// One captured Wiegand edge: which data line pulsed and when
+typedef struct {
+  uint32_t cycles;   // CPU cycle counter at the falling edge
+  byte bit;          // 0 = pulse on DATA0, 1 = pulse on DATA1
+} WiegandEdge;
+
+// Single-producer/single-consumer lock-free ring buffer.
+// The producer (the Wiegand ISRs) only advances head, the consumer (loop)
+// only advances tail, so neither side ever needs to disable interrupts.
+template <typename T, uint16_t SIZE>
+class SpscRing {
+  static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "SpscRing size must be a power of two");
+
+private:
+  T items[SIZE];
+  std::atomic<uint16_t> head;
+  std::atomic<uint16_t> tail;
+  volatile uint32_t dropped;
+
+public:
+  SpscRing() : head(0), tail(0), dropped(0) {}
+
+  // Producer side - safe to call from an ISR. Returns false if the ring is full.
+  inline bool IRAM_ATTR push(const T& item) {
+    uint16_t h = head.load(std::memory_order_relaxed);
+    if ((uint16_t)(h - tail.load(std::memory_order_acquire)) >= SIZE) {
+      dropped = dropped + 1;
+      return false;
+    }
+    items[h & (SIZE - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side - copies up to maxItems entries into out, returns how many
+  uint16_t popBatch(T* out, uint16_t maxItems) {
+    uint16_t t = tail.load(std::memory_order_relaxed);
+    uint16_t available = head.load(std::memory_order_acquire) - t;
+    uint16_t count = available < maxItems ? available : maxItems;
+    for (uint16_t i = 0; i < count; i++) {
+      out[i] = items[(uint16_t)(t + i) & (SIZE - 1)];
+    }
+    tail.store(t + count, std::memory_order_release);
+    return count;
+  }
+
+  // Consumer side - copies the oldest entry without removing it
+  bool peek(T& item) const {
+    uint16_t t = tail.load(std::memory_order_relaxed);
+    if (head.load(std::memory_order_acquire) == t) {
+      return false;
+    }
+    item = items[t & (SIZE - 1)];
+    return true;
+  }
+
+  uint16_t size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+  }
+
+  // Free-running totals, usable as positions in the stream of items
+  uint16_t pushedCount() const {
+    return head.load(std::memory_order_acquire);
+  }
+
+  uint16_t poppedCount() const {
+    return tail.load(std::memory_order_relaxed);
+  }
+
+  // Number of items rejected because the consumer fell a full ring behind
+  uint32_t droppedCount() const {
+    return dropped;
+  }
+};
+
+// Edges captured for one reader, and the edge ring positions at which the
+// line went quiet (one per closed frame)
+typedef SpscRing<WiegandEdge, EDGE_RING_SIZE> EdgeRing;
+typedef SpscRing<uint16_t, FRAME_END_RING_SIZE> FrameEndRing;
+
+#endif //EDGE_RING_H
@@ -0,0 +1,188 @@
+#include "fdxb_decoder.h"
+
+// CRC-16 lookup table for the reflected CCITT polynomial (0x8408)
+static const uint16_t FDXB_CRC_TABLE[256] = {
+    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF,
+    0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+    0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
+    0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+    0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD,
+    0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C,
+    0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+    0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
+    0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+    0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A,
+    0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9,
+    0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+    0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
+    0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+    0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7,
+    0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
+    0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+    0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
+    0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+    0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134,
+    0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3,
+    0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+    0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
+    0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+    0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1,
+    0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330,
+    0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78,
+};
+
+uint16_t fdxbCrc16(const uint8_t* data, int length) {
+    uint16_t crc = 0;
+    for (int i = 0; i < length; i++) {
+        crc = (crc >> 8) ^ FDXB_CRC_TABLE[(crc ^ data[i]) & 0xFF];
+    }
+    return crc;
+}
+
+static inline int telegramBit(const uint8_t* raw, int position) {
+    return (raw[position >> 3] >> (position & 7)) & 1;
+}
+
+static inline void setTelegramBit(uint8_t* raw, int position) {
+    raw[position >> 3] |= 1 << (position & 7);
+}
+
+static uint64_t fdxbAnimalId(uint16_t countryCode, uint64_t nationalId) {
+    return countryCode * 1000000000000ULL + nationalId;
+}
+
+bool decodeFdxbTelegram(const uint8_t* raw, FdxbTag& tag) {
+    // Header: ten 0s, then a 1
+    for (int i = 0; i < 10; i++) {
+        if (telegramBit(raw, i)) return false;
+    }
+    if (!telegramBit(raw, 10)) return false;
+
+    // 13 bytes, LSB first, each followed by a 1 control bit
+    uint8_t bytes[13];
+    int position = 11;
+    for (int b = 0; b < 13; b++) {
+        uint8_t value = 0;
+        for (int i = 0; i < 8; i++) {
+            value |= telegramBit(raw, position++) << i;
+        }
+        if (!telegramBit(raw, position++)) return false;
+        bytes[b] = value;
+    }
+
+    uint16_t crc = bytes[8] | (bytes[9] << 8);
+    if (fdxbCrc16(bytes, 8) != crc) return false;
+
+    uint64_t identification = 0;
+    for (int b = 7; b >= 0; b--) {
+        identification = (identification << 8) | bytes[b];
+    }
+
+    tag.nationalId = identification & FDXB_MAX_NATIONAL_ID;
+    tag.countryCode = (identification >> 38) & 0x3FF;
+    tag.hasDataBlock = (identification >> 48) & 1;
+    tag.reserved = (identification >> 49) & 0x3FFF;
+    tag.animal = (identification >> 63) & 1;
+    tag.extendedData = bytes[10] | (bytes[11] << 8) | ((uint32_t)bytes[12] << 16);
+
+    if (tag.countryCode > FDXB_MAX_COUNTRY) return false;
+    tag.id = fdxbAnimalId(tag.countryCode, tag.nationalId);
+    return true;
+}
+
+void encodeFdxbTelegram(const FdxbTag& tag, uint8_t* raw) {
+    uint64_t identification = (tag.nationalId & FDXB_MAX_NATIONAL_ID)
+                            | ((uint64_t)(tag.countryCode & 0x3FF) << 38)
+                            | ((uint64_t)tag.hasDataBlock << 48)
+                            | ((uint64_t)(tag.reserved & 0x3FFF) << 49)
+                            | ((uint64_t)tag.animal << 63);
+
+    uint8_t bytes[13];
+    for (int b = 0; b < 8; b++) {
+        bytes[b] = (identification >> (8 * b)) & 0xFF;
+    }
+    uint16_t crc = fdxbCrc16(bytes, 8);
+    bytes[8] = crc & 0xFF;
+    bytes[9] = crc >> 8;
+    bytes[10] = tag.extendedData & 0xFF;
+    bytes[11] = (tag.extendedData >> 8) & 0xFF;
+    bytes[12] = (tag.extendedData >> 16) & 0xFF;
+
+    for (int i = 0; i < FDXB_TELEGRAM_BYTES; i++) {
+        raw[i] = 0;
+    }
+    setTelegramBit(raw, 10);
+    int position = 11;
+    for (int b = 0; b < 13; b++) {
+        for (int i = 0; i < 8; i++, position++) {
+            if ((bytes[b] >> i) & 1) setTelegramBit(raw, position);
+        }
+        setTelegramBit(raw, position++);
+    }
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+static bool isSeparator(char c) {
+    return c == ' ' || c == '_' || c == '-' || c == '.';
+}
+
+bool decodeFdxbLine(const char* line, FdxbTag& tag) {
+    int length = 0;
+    while (line[length] && line[length] != '\r' && line[length] != '\n') {
+        length++;
+    }
+
+    // Raw telegram: exactly 32 hex digits, byte 0 first
+    if (length == 2 * FDXB_TELEGRAM_BYTES) {
+        uint8_t raw[FDXB_TELEGRAM_BYTES];
+        bool hex = true;
+        for (int i = 0; i < FDXB_TELEGRAM_BYTES && hex; i++) {
+            int high = hexValue(line[2 * i]);
+            int low = hexValue(line[2 * i + 1]);
+            hex = high >= 0 && low >= 0;
+            raw[i] = (high << 4) | low;
+        }
+        if (hex) {
+            return decodeFdxbTelegram(raw, tag);
+        }
+    }
+
+    // Decimal animal ID: exactly 15 digits, separators only between digits
+    uint64_t id = 0;
+    int digits = 0;
+    for (int i = 0; i < length; i++) {
+        char c = line[i];
+        if (c >= '0' && c <= '9') {
+            id = id * 10 + (c - '0');
+            digits++;
+        } else if (!isSeparator(c) || digits == 0 || i == length - 1) {
+            return false;
+        }
+    }
+    if (digits != 15) return false;
+
+    uint64_t nationalId = id % 1000000000000ULL;
+    uint16_t countryCode = id / 1000000000000ULL;
+    if (nationalId > FDXB_MAX_NATIONAL_ID) return false;
+
+    // The decimal form carries neither the flags nor the extended data
+    tag.countryCode = countryCode;
+    tag.nationalId = nationalId;
+    tag.animal = true;
+    tag.hasDataBlock = false;
+    tag.reserved = 0;
+    tag.extendedData = 0;
+    tag.id = id;
+    return true;
+}
@@ -0,0 +1,45 @@
+#ifndef FDXB_DECODER_H
+#define FDXB_DECODER_H
+
+#include <stdint.h>
+
+// ISO 11784/11785 FDX-B animal tag decoding.
+// Has no Arduino dependencies so it can also be built on a host.
+//
+// A 128-bit FDX-B telegram, in transmission order, is an 11-bit header
+// (ten 0s and a 1) followed by 13 bytes sent LSB first, each followed by a
+// 1 control bit: 8 identification bytes, the 2-byte CRC over them and
+// 3 bytes of extended data.
+// The 64 identification bits, LSB first, are the 38-bit national ID,
+// 10-bit country code, data block flag, 14 reserved bits and animal flag.
+
+#define FDXB_TELEGRAM_BYTES 16
+#define FDXB_MAX_COUNTRY 999
+#define FDXB_MAX_NATIONAL_ID ((1ULL << 38) - 1)
+
+typedef struct {
+    uint16_t countryCode;     // ISO 3166 numeric, or 900-998 for manufacturer codes
+    uint64_t nationalId;      // 38 bits
+    bool animal;              // Set for animal identification
+    bool hasDataBlock;        // Extended data present
+    uint16_t reserved;        // 14 reserved bits (RUDI and friends)
+    uint32_t extendedData;    // 24 bits, meaningful if hasDataBlock
+    uint64_t id;              // Animal ID as printed: country * 10^12 + national ID
+} FdxbTag;
+
+// CRC-CCITT as FDX-B uses it: polynomial 0x1021 bit-reflected, initial value 0
+uint16_t fdxbCrc16(const uint8_t* data, int length);
+
+// Decode a raw telegram, bit i of the telegram is bit (i % 8) of raw[i / 8].
+// Checks the header, every control bit and the CRC.
+bool decodeFdxbTelegram(const uint8_t* raw, FdxbTag& tag);
+
+// Build the raw telegram for a tag (simulation and benchmarks)
+void encodeFdxbTelegram(const FdxbTag& tag, uint8_t* raw);
+
+// Decode one line from the reader module: either the 15-digit animal ID
+// (3-digit country then 12-digit national ID, separators allowed between
+// digits) or a raw telegram as 32 hex digits. Trailing CR/LF are ignored.
+bool decodeFdxbLine(const char* line, FdxbTag& tag);
+
+#endif //FDXB_DECODER_H
@@ -0,0 +1,91 @@
+#include "rfid_frontend.h"
+
+#if RFID_FRONTEND == RFID_FRONTEND_FDXB_UART
+
+#include "logic_capture.h"
+
+RfidFrontEnd rfidFrontEnd;
+
+FdxbUartFrontEnd::FdxbUartFrontEnd()
+    : lineLength(0), lastUartErrors(0),
+      tagPresence(PRESENCE_INITIAL_INTERVAL_MS, PRESENCE_MIN_TIMEOUT_MS, PRESENCE_MAX_TIMEOUT_MS, PRESENCE_ARRIVE_READS) {
+    memset(line, 0, sizeof(line));
+    memset(&lastTag, 0, sizeof(lastTag));
+}
+
+bool FdxbUartFrontEnd::begin() {
+    // Logic capture records the bytes received from the module
+    static const char* const captureChannels[] = { "rfid_rx" };
+    logicCapture.setChannels(captureChannels, 1, 8);
+
+    // ESP-IDF UART driver and RX task for the RFID module, queue complete lines
+    if (!rfidUart.begin(FDXB_RX_PIN, FDXB_TX_PIN)) {
+        debugPrint("Failed to start the RFID UART driver");
+        return false;
+    }
+
+    debugPrint("RFID reader initialized on UART2");
+    return true;
+}
+
+// Take the next complete line the RX task has queued
+bool FdxbUartFrontEnd::nextRead(TagRead& read) {
+    // Report reads lost to overflows or line errors
+    if (rfidUart.errorCount() != lastUartErrors) {
+        lastUartErrors = rfidUart.errorCount();
+        const RfidUartStats& uartStats = rfidUart.getStats();
+        Serial.print("WARNING: RFID UART errors - dropped lines: ");
+        Serial.print(uartStats.droppedLines);
+        Serial.print(", FIFO overflows: ");
+        Serial.print(uartStats.fifoOverflows);
+        Serial.print(", buffer overflows: ");
+        Serial.print(uartStats.bufferOverflows);
+        Serial.print(", framing errors: ");
+        Serial.print(uartStats.framingErrors);
+        Serial.print(", parity errors: ");
+        Serial.println(uartStats.parityErrors);
+    }
+
+    uint32_t lineEndMicros;
+    lineLength = rfidUart.readLine(line, sizeof(line), lineEndMicros);
+    if (lineLength <= 0) {
+        return false;
+    }
+
+    // Diagnostic capture of the raw byte stream, the bytes arrived back to back
+    // ending when the driver saw the terminator
+    for (int i = 0; i < lineLength; i++) {
+        logicCapture.record(lineEndMicros - (lineLength - 1 - i) * RFID_UART_BYTE_US, 0, line[i]);
+    }
+
+    // Only lines that decode to a valid animal ID are tags, anything else is noise
+    read.reader = 0;
+    read.valid = decodeFdxbLine(line, lastTag);
+    read.tagId = read.valid ? lastTag.id : 0;
+    return true;
+}
+
+void FdxbUartFrontEnd::printRead(const TagRead& read) {
+    Serial.print("Raw data: ");
+    Serial.println(line);
+
+    if (read.valid) {
+        Serial.print("Country: ");
+        Serial.print(lastTag.countryCode);
+        Serial.print(", National ID: ");
+        Serial.print((unsigned long long)lastTag.nationalId);
+        Serial.println(lastTag.animal ? ", animal" : "");
+    }
+}
+
+// Sleep until the RFID module sends a line, or at most FDXB_IDLE_WAIT_MS
+void FdxbUartFrontEnd::idle() {
+    rfidUart.waitForLine(pdMS_TO_TICKS(FDXB_IDLE_WAIT_MS));
+}
+
+void FdxbUartFrontEnd::resetStats() {
+    rfidUart.resetStats();
+    lastUartErrors = 0;
+}
+
+#endif // RFID_FRONTEND == RFID_FRONTEND_FDXB_UART
@@ -0,0 +1,45 @@
+#ifndef FDXB_FRONTEND_H
+#define FDXB_FRONTEND_H
+
+#include <Arduino.h>
+#include "state.h"
+#include "tag_read.h"
+#include "rfid_uart.h"
+#include "fdxb_decoder.h"
+#include "presence_tracker.h"
+
+#define FDXB_RX_PIN 0          // Module TX, RX0 on D0
+#define FDXB_TX_PIN 1          // TX0 on D1
+#define FDXB_IDLE_WAIT_MS 10   // Longest loop() sleeps waiting for a line, short enough not to miss a button press
+
+// Presence detection (see presence_tracker.h)
+#define PRESENCE_INITIAL_INTERVAL_MS 1000 // Assumed repeat interval until the reader's is learned
+#define PRESENCE_MIN_TIMEOUT_MS 2500      // Never close sooner than this, outlasts a missed repeat of the module
+#define PRESENCE_MAX_TIMEOUT_MS 5000      // Worst case, the previous fixed tag timeout
+#define PRESENCE_ARRIVE_READS 1           // The reader repeats slowly, open on the first read
+
+// One FDX-B module on the ESP-IDF UART driver (rfid_uart.h). Every complete
+// line the RX task queued becomes one TagRead, always from reader 0.
+class FdxbUartFrontEnd {
+private:
+    char line[RFID_LINE_MAX];      // Last line taken from the queue, fits a raw telegram line
+    int lineLength;
+    FdxbTag lastTag;               // Decoded from line, for printRead()
+    uint32_t lastUartErrors;       // errorCount() when last reported
+    PresenceTracker tagPresence;   // Authorized pet at the bowl
+
+public:
+    FdxbUartFrontEnd();
+
+    bool begin();
+    int readerCount() const { return 1; }
+    bool nextRead(TagRead& read);
+    void printRead(const TagRead& read);
+    void idle();
+    void resetStats();
+
+    // The FDX-B front end has exactly one reader, index 0
+    PresenceTracker& presence(int) { return tagPresence; }
+};
+
+#endif //FDXB_FRONTEND_H
@@ -0,0 +1,111 @@
+#ifndef FDXB_STREAM_SIM_H
+#define FDXB_STREAM_SIM_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "fdxb_decoder.h"
+
+// Synthetic byte streams as the RFID module would send them: valid reads in
+// both line formats plus the faults the parser has to survive.
+// Has no Arduino dependencies so it can also be built on a host.
+
+typedef enum {
+    FDXB_LINE_DECIMAL,      // "999123456789012"
+    FDXB_LINE_RAW,          // 32 hex digits of the raw telegram
+    FDXB_LINE_GARBAGE,      // Random printable noise
+    FDXB_LINE_OVERSIZED,    // A valid ID buried in a line too long for the buffer
+    FDXB_LINE_BAD_CRC       // Raw telegram with a flipped identification bit
+} FdxbLineKind;
+
+typedef struct {
+    bool crlf;                   // Terminate lines with CR LF instead of CR
+    uint8_t rawPercent;          // Valid lines sent as raw telegrams instead of decimal
+    uint8_t garbagePercent;
+    uint8_t oversizedPercent;
+    uint8_t badCrcPercent;
+    uint8_t maxChunk;            // Deliver in chunks of 1..maxChunk bytes, 0 = whole lines
+} FdxbStreamConfig;
+
+class FdxbStreamSim {
+private:
+    uint32_t rngState;
+
+public:
+    explicit FdxbStreamSim(uint32_t seed) : rngState(seed ? seed : 1) {}
+
+    // xorshift32 - fast and deterministic, so runs are reproducible
+    uint32_t random() {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 17;
+        rngState ^= rngState << 5;
+        return rngState;
+    }
+
+    FdxbLineKind pickKind(const FdxbStreamConfig& config) {
+        uint32_t roll = random() % 100;
+        if (roll < config.garbagePercent) return FDXB_LINE_GARBAGE;
+        roll -= config.garbagePercent;
+        if (roll < config.oversizedPercent) return FDXB_LINE_OVERSIZED;
+        roll -= config.oversizedPercent;
+        if (roll < config.badCrcPercent) return FDXB_LINE_BAD_CRC;
+        return random() % 100 < config.rawPercent ? FDXB_LINE_RAW : FDXB_LINE_DECIMAL;
+    }
+
+    FdxbTag randomTag() {
+        FdxbTag tag = {};
+        tag.countryCode = 900 + random() % 100;
+        tag.nationalId = (((uint64_t)random() << 32) | random()) % 1000000000000ULL;
+        if (tag.nationalId > FDXB_MAX_NATIONAL_ID) tag.nationalId &= FDXB_MAX_NATIONAL_ID;
+        tag.animal = true;
+        tag.id = tag.countryCode * 1000000000000ULL + tag.nationalId;
+        return tag;
+    }
+
+    // Write one line of the given kind, terminator included. expected gets the
+    // tag the parser must report; returns the line length, valid tells whether
+    // the line should decode at all.
+    int generate(FdxbLineKind kind, const FdxbStreamConfig& config, char* out, int maxLength,
+                 FdxbTag& expected, bool& valid) {
+        int length = 0;
+        expected = randomTag();
+        valid = kind == FDXB_LINE_DECIMAL || kind == FDXB_LINE_RAW;
+
+        switch (kind) {
+            case FDXB_LINE_DECIMAL:
+            case FDXB_LINE_OVERSIZED:
+                if (kind == FDXB_LINE_OVERSIZED) {
+                    for (; length < 40 && length < maxLength - 24; length++) out[length] = 'X';
+                }
+                length += snprintf(out + length, maxLength - length, "%03u%012llu",
+                                   expected.countryCode, (unsigned long long)expected.nationalId);
+                break;
+            case FDXB_LINE_RAW:
+            case FDXB_LINE_BAD_CRC: {
+                uint8_t raw[FDXB_TELEGRAM_BYTES];
+                encodeFdxbTelegram(expected, raw);
+                if (kind == FDXB_LINE_BAD_CRC) {
+                    // Bits 11..82 carry the identification bytes and their control bits
+                    int bit = 11 + random() % 72;
+                    raw[bit / 8] ^= 1 << (bit % 8);
+                }
+                for (int i = 0; i < FDXB_TELEGRAM_BYTES; i++) {
+                    length += snprintf(out + length, maxLength - length, "%02X", raw[i]);
+                }
+                break;
+            }
+            case FDXB_LINE_GARBAGE: {
+                int garbage = 1 + random() % 20;
+                for (; length < garbage && length < maxLength - 3; length++) {
+                    out[length] = 0x21 + random() % 94; // Printable, never a terminator
+                }
+                break;
+            }
+        }
+
+        out[length++] = '\r';
+        if (config.crlf) out[length++] = '\n';
+        return length;
+    }
+};
+
+#endif //FDXB_STREAM_SIM_H
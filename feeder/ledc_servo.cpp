@@ -0,0 +1,119 @@
+#include "ledc_servo.h"
+
+LedcServo::LedcServo(ledc_channel_t channel, ledc_timer_t timer)
+    : channel(channel), timer(timer), dutyPerUsQ16(0), resolutionBits(0), attached(false),
+      idleOffMs(0), powerPin(-1), pulsing(false), lastWrite(0), idleSince(0), idleMsTotal(0), idleOffCount(0) {
+    memset(&calibration, 0, sizeof(calibration));
+}
+
+// Finest resolution whose full count still fits one period of the source clock
+uint8_t LedcServo::resolutionFor(uint32_t refreshHz) {
+    uint8_t bits = LEDC_SERVO_MAX_BITS;
+    if (bits > SOC_LEDC_TIMER_BIT_WIDE_NUM) {
+        bits = SOC_LEDC_TIMER_BIT_WIDE_NUM;
+    }
+    while (bits > 1 && ((uint64_t)refreshHz << bits) > LEDC_SERVO_SOURCE_HZ) {
+        bits--;
+    }
+    return bits;
+}
+
+bool LedcServo::begin(int pin, const ServoCalibration& servoCalibration, uint32_t refreshHz, float startDegrees) {
+    calibration = servoCalibration;
+    resolutionBits = resolutionFor(refreshHz);
+    // counts per us = refreshHz * 2^bits / 1e6
+    dutyPerUsQ16 = (uint32_t)((((uint64_t)refreshHz << resolutionBits) << 16) / 1000000);
+
+    ledc_timer_config_t timerConfig = {};
+    timerConfig.speed_mode = LEDC_LOW_SPEED_MODE;
+    timerConfig.duty_resolution = (ledc_timer_bit_t)resolutionBits;
+    timerConfig.timer_num = timer;
+    timerConfig.freq_hz = refreshHz;
+    timerConfig.clk_cfg = LEDC_AUTO_CLK;
+    if (ledc_timer_config(&timerConfig) != ESP_OK) {
+        return false;
+    }
+
+    ledc_channel_config_t channelConfig = {};
+    channelConfig.gpio_num = digitalPinToGPIONumber(pin);
+    channelConfig.speed_mode = LEDC_LOW_SPEED_MODE;
+    channelConfig.channel = channel;
+    channelConfig.intr_type = LEDC_INTR_DISABLE;
+    channelConfig.timer_sel = timer;
+    channelConfig.duty = (uint32_t)(((uint64_t)degreesToMicros(startDegrees) * dutyPerUsQ16) >> 16);
+    channelConfig.hpoint = 0;
+    if (ledc_channel_config(&channelConfig) != ESP_OK) {
+        return false;
+    }
+
+    attached = true;
+    pulsing = true;
+    lastWrite = millis();
+    return true;
+}
+
+void LedcServo::setIdleOff(uint32_t idleMs, int pin) {
+    idleOffMs = idleMs;
+    powerPin = pin;
+    if (powerPin >= 0) {
+        pinMode(powerPin, OUTPUT);
+        digitalWrite(powerPin, HIGH);
+    }
+}
+
+// Two driver calls and a multiply, safe from the esp_timer task
+void LedcServo::writeMicroseconds(uint16_t pulseUs) {
+    if (!attached) {
+        return;
+    }
+    uint32_t duty = (uint32_t)(((uint64_t)pulseUs * dutyPerUsQ16) >> 16);
+    ledc_set_duty(LEDC_LOW_SPEED_MODE, channel, duty);
+    ledc_update_duty(LEDC_LOW_SPEED_MODE, channel); // Also restarts a stopped channel
+
+    unsigned long now = millis();
+    if (!pulsing) {
+        // Re-arm: the pulse is already set, so the servo powers up at the new position
+        if (powerPin >= 0) {
+            digitalWrite(powerPin, HIGH);
+        }
+        idleMsTotal += now - idleSince;
+        pulsing = true;
+    }
+    lastWrite = now;
+}
+
+void LedcServo::checkIdle() {
+    if (!attached || !pulsing || idleOffMs == 0) {
+        return;
+    }
+
+    unsigned long now = millis();
+    if (now - lastWrite < idleOffMs) {
+        return;
+    }
+
+    // Without pulses the servo stops driving and holds by friction alone
+    ledc_stop(LEDC_LOW_SPEED_MODE, channel, 0);
+    if (powerPin >= 0) {
+        digitalWrite(powerPin, LOW);
+    }
+    pulsing = false;
+    idleSince = now;
+    idleOffCount++;
+}
+
+uint64_t LedcServo::idleMillis() const {
+    return pulsing ? idleMsTotal : idleMsTotal + (millis() - idleSince);
+}
+
+void LedcServo::writeDegrees(float degrees) {
+    writeMicroseconds(degreesToMicros(degrees));
+}
+
+uint16_t LedcServo::degreesToMicros(float degrees) const {
+    if (degrees < 0) degrees = 0;
+    if (degrees > calibration.rangeDegrees) degrees = calibration.rangeDegrees;
+    // maxUs may be below minUs for a servo mounted the other way round
+    float offsetUs = degrees * ((int)calibration.maxUs - (int)calibration.minUs) / calibration.rangeDegrees;
+    return (uint16_t)(calibration.minUs + (int)(offsetUs < 0 ? offsetUs - 0.5f : offsetUs + 0.5f));
+}
@@ -0,0 +1,72 @@
+#ifndef LEDC_SERVO_H
+#define LEDC_SERVO_H
+
+#include <Arduino.h>
+#include <driver/ledc.h>
+#include <soc/soc_caps.h>
+
+#define LEDC_SERVO_SOURCE_HZ 80000000  // APB clock feeding the LEDC timers
+#define LEDC_SERVO_MAX_BITS 16         // Finest duty resolution used, when the chip and frequency allow
+
+// Pulse widths of one servo, measured at two angles
+typedef struct {
+    uint16_t minUs;         // Pulse at 0 degrees
+    uint16_t maxUs;         // Pulse at rangeDegrees
+    uint16_t rangeDegrees;  // Angle maxUs drives the horn to
+} ServoCalibration;
+
+// A hobby servo on one LEDC channel, programmed through the ESP-IDF driver.
+// The duty resolution is the finest the chip supports at the refresh rate
+// (14 bits on the ESP32-S3, 16 on the ESP32), about a microsecond or better,
+// instead of the whole degrees Servo::write() works in.
+// Optionally the pulse train stops once the servo has been left alone for a
+// while (and its supply is switched off), the next write re-arms it.
+class LedcServo {
+private:
+    const ledc_channel_t channel;
+    const ledc_timer_t timer;
+    ServoCalibration calibration;
+    uint32_t dutyPerUsQ16;    // Duty counts per microsecond, Q16
+    uint8_t resolutionBits;
+    bool attached;
+
+    // Idle power gating
+    uint32_t idleOffMs;       // Stop pulsing this long after the last write, 0 to always pulse
+    int powerPin;             // Switches the servo supply, -1 if not wired
+    bool pulsing;
+    unsigned long lastWrite;  // millis() of the last write
+    unsigned long idleSince;  // millis() when pulsing stopped
+    uint64_t idleMsTotal;     // Finished idle periods
+    uint32_t idleOffCount;
+
+    static uint8_t resolutionFor(uint32_t refreshHz);
+
+public:
+    LedcServo(ledc_channel_t channel, ledc_timer_t timer);
+
+    // Configure the timer and channel and start the pulse train at startDegrees, pin is an Arduino pin
+    bool begin(int pin, const ServoCalibration& calibration, uint32_t refreshHz, float startDegrees);
+
+    // Stop the pulse train idleOffMs after the last write, and switch powerPin
+    // low as well if the servo supply is wired through it
+    void setIdleOff(uint32_t idleOffMs, int powerPin = -1);
+
+    // Writes re-arm a servo that went idle, at the new position
+    void writeMicroseconds(uint16_t pulseUs);
+    void writeDegrees(float degrees);
+
+    // Go idle if nothing was written for idleOffMs, call periodically
+    void checkIdle();
+
+    // Calibrated pulse width for an angle, fractional degrees allowed
+    uint16_t degreesToMicros(float degrees) const;
+
+    bool isAttached() const { return attached; }
+    uint8_t resolution() const { return resolutionBits; }
+
+    bool isPulsing() const { return pulsing; }
+    uint32_t idleOffs() const { return idleOffCount; }
+    uint64_t idleMillis() const;   // Time spent idle, including the current idle period
+};
+
+#endif //LEDC_SERVO_H
@@ -0,0 +1,68 @@
+#include "lid_arbiter.h"
+
+#define LID_SOURCE_SHIFT(source) ((source) * 8)
+
+LidArbiter::LidArbiter(ServoTrajectory& lid, int ledPin, const LidAction& open, const LidAction& close)
+    : lid(lid), ledPin(ledPin), openAction(open), closeAction(close), mailbox(0), tickTimer(NULL),
+      applied(LID_INTENT_CLOSE), appliedSource(LID_SOURCE_IDLE), actuations(0) {
+}
+
+bool LidArbiter::begin(uint32_t tickUs) {
+    // The idle source always holds the lid closed, so some intent always wins
+    post(LID_SOURCE_IDLE, LID_INTENT_CLOSE);
+    digitalWrite(ledPin, closeAction.ledOn ? HIGH : LOW);
+
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = &LidArbiter::onTick;
+    timerArgs.arg = this;
+    timerArgs.name = "lid_arbiter";
+    if (esp_timer_create(&timerArgs, &tickTimer) != ESP_OK) {
+        return false;
+    }
+    return esp_timer_start_periodic(tickTimer, tickUs) == ESP_OK;
+}
+
+void LidArbiter::onTick(void* arg) {
+    static_cast<LidArbiter*>(arg)->tick();
+}
+
+void IRAM_ATTR LidArbiter::post(LidSource source, LidIntent intent) {
+    const uint32_t mask = 0xFFu << LID_SOURCE_SHIFT(source);
+    const uint32_t value = (uint32_t)intent << LID_SOURCE_SHIFT(source);
+    uint32_t current = mailbox.load(std::memory_order_relaxed);
+    while (!mailbox.compare_exchange_weak(current, (current & ~mask) | value, std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+    }
+}
+
+LidIntent LidArbiter::intent(LidSource source) const {
+    return (LidIntent)((mailbox.load(std::memory_order_acquire) >> LID_SOURCE_SHIFT(source)) & 0xFF);
+}
+
+void LidArbiter::tick() {
+    // One snapshot of every source, so a tick never sees half an update
+    uint32_t intents = mailbox.load(std::memory_order_acquire);
+
+    LidSource source = LID_SOURCE_IDLE;
+    LidIntent winning = LID_INTENT_CLOSE;
+    for (int s = LID_SOURCE_COUNT - 1; s >= 0; s--) {
+        LidIntent posted = (LidIntent)((intents >> LID_SOURCE_SHIFT(s)) & 0xFF);
+        if (posted != LID_INTENT_NONE) {
+            source = (LidSource)s;
+            winning = posted;
+            break;
+        }
+    }
+    appliedSource = source;
+
+    // Drive the lid only when the outcome changes, not for every repeated post
+    if (winning == applied) {
+        return;
+    }
+    applied = winning;
+    actuations++;
+
+    const LidAction& action = winning == LID_INTENT_OPEN ? openAction : closeAction;
+    digitalWrite(ledPin, action.ledOn ? HIGH : LOW);
+    lid.moveTo(action.position, action.fullRangeTime, action.profile); // Turns around if the lid is still moving
+}
@@ -0,0 +1,72 @@
+#ifndef LID_ARBITER_H
+#define LID_ARBITER_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <esp_timer.h>
+#include "servo_trajectory.h"
+
+#define LID_ARBITER_TICK_US 10000   // Control tick, how often the winning intent is applied
+
+// Who asks for the lid, lowest priority first
+enum LidSource {
+    LID_SOURCE_IDLE,       // Resting state, the lid stays closed
+    LID_SOURCE_SCHEDULE,   // Scheduled tasks
+    LID_SOURCE_TAG,        // An authorized pet at a bowl
+    LID_SOURCE_BUTTON,     // The manual lid button, overrides everything
+    LID_SOURCE_COUNT
+};
+
+// What a source asks for
+enum LidIntent {
+    LID_INTENT_NONE,       // No opinion, a lower priority source decides
+    LID_INTENT_OPEN,
+    LID_INTENT_CLOSE
+};
+
+// How the lid and LED are driven for one intent
+typedef struct {
+    int position;          // Servo angle
+    int fullRangeTime;     // ms for the full travel
+    EasingProfile profile;
+    bool ledOn;
+} LidAction;
+
+// Sole owner of the lid servo and LED. Producers post an intent for their
+// source into a lock-free mailbox - one byte per source in a single atomic
+// word, so posting is safe from ISRs and either core. Once per control tick
+// the highest priority source with an intent wins, and the lid and LED are
+// only driven when the winner asks for something other than what they do.
+class LidArbiter {
+private:
+    ServoTrajectory& lid;
+    const int ledPin;
+    const LidAction openAction;
+    const LidAction closeAction;
+    std::atomic<uint32_t> mailbox;   // Byte n holds the LidIntent of LidSource n
+    esp_timer_handle_t tickTimer;
+    LidIntent applied;               // Intent the lid and LED currently follow
+    LidSource appliedSource;
+    uint32_t actuations;
+
+    static void onTick(void* arg);
+
+public:
+    LidArbiter(ServoTrajectory& lid, int ledPin, const LidAction& open, const LidAction& close);
+
+    // Take over the lid (already at the close position) and LED, start the control tick
+    bool begin(uint32_t tickUs = LID_ARBITER_TICK_US);
+
+    // Replace the intent of one source, LID_INTENT_NONE withdraws it. Safe from ISRs.
+    void IRAM_ATTR post(LidSource source, LidIntent intent);
+
+    // Apply the winning intent, called by the control tick
+    void tick();
+
+    LidIntent intent(LidSource source) const;
+    LidSource winner() const { return appliedSource; }
+    bool isOpen() const { return applied == LID_INTENT_OPEN; }
+    uint32_t actuationCount() const { return actuations; }
+};
+
+#endif //LID_ARBITER_H
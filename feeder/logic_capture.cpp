@@ -0,0 +1,27 @@
+#include "logic_capture.h"
+
+LogicCapture logicCapture;
+
+LogicCapture::LogicCapture() : head(0), recorded(0), armed(false), channelCount(0), valueWidth(1) {
+    portMUX_INITIALIZE(&lock);
+}
+
+void LogicCapture::setChannels(const char* const* names, uint8_t count, uint8_t width) {
+    if (count > LOGIC_CAPTURE_CHANNELS) {
+        count = LOGIC_CAPTURE_CHANNELS;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        channelNames[i] = names[i];
+    }
+    channelCount = count;
+    valueWidth = width;
+}
+
+// Clear the ring and start recording
+void LogicCapture::start() {
+    portENTER_CRITICAL(&lock);
+    head = 0;
+    recorded = 0;
+    armed = true;
+    portEXIT_CRITICAL(&lock);
+}
@@ -0,0 +1,77 @@
+#ifndef LOGIC_CAPTURE_H
+#define LOGIC_CAPTURE_H
+
+#include <Arduino.h>
+
+#define LOGIC_CAPTURE_SIZE 1024      // Samples kept, the oldest are overwritten (power of two)
+#define LOGIC_CAPTURE_CHANNELS 8     // Most channels a capture can name
+
+// One recorded sample: a Wiegand edge or a received UART byte
+typedef struct {
+    uint32_t timeUs;     // micros() at the sample
+    uint8_t channel;
+    uint8_t value;       // Byte received, or the line level after an edge
+} CaptureSample;
+
+// Diagnostic logic-analyzer capture. While armed, raw input samples are
+// recorded into a RAM ring that the web server downloads as VCD or binary.
+// Wiegand edges are recorded from the pin ISRs / RMT callback as they are
+// captured, so record() takes a spinlock. The pin ISRs only see falls, they
+// record a rise when the line is first seen high again - use the RMT capture
+// for exact pulse widths. Stop the capture before downloading it, or the
+// oldest samples may be overwritten mid-download.
+//
+// Binary download format, little endian:
+//   "LCAP", uint8 version (2), uint8 channel count, uint8 value width in bits,
+//   uint32 sample count, uint32 samples overwritten, then per channel a
+//   length-prefixed name, then per sample uint32 timeUs, uint8 channel, uint8 value.
+class LogicCapture {
+private:
+    CaptureSample samples[LOGIC_CAPTURE_SIZE];
+    uint16_t head;
+    uint32_t recorded;          // Samples recorded since start()
+    volatile bool armed;
+    portMUX_TYPE lock;          // Shared with the ISRs that record
+
+    const char* channelNames[LOGIC_CAPTURE_CHANNELS];
+    uint8_t channelCount;
+    uint8_t valueWidth;         // 1 = line levels, 8 = bytes
+
+public:
+    LogicCapture();
+
+    // Channel names live as long as the capture (string literals)
+    void setChannels(const char* const* names, uint8_t count, uint8_t width);
+
+    void start();
+    void stop() { armed = false; }
+    bool isArmed() const { return armed; }
+
+    // Safe from ISRs and either core
+    inline void IRAM_ATTR record(uint32_t timeUs, uint8_t channel, uint8_t value) {
+        if (!armed) return;
+        portENTER_CRITICAL_SAFE(&lock);
+        CaptureSample& sample = samples[head];
+        sample.timeUs = timeUs;
+        sample.channel = channel;
+        sample.value = value;
+        head = (head + 1) & (LOGIC_CAPTURE_SIZE - 1);
+        recorded++;
+        portEXIT_CRITICAL_SAFE(&lock);
+    }
+
+    uint16_t size() const { return recorded < LOGIC_CAPTURE_SIZE ? recorded : LOGIC_CAPTURE_SIZE; }
+    uint32_t overwritten() const { return recorded - size(); }
+    // Oldest sample first
+    const CaptureSample& sample(uint16_t i) const {
+        return samples[(head - size() + i) & (LOGIC_CAPTURE_SIZE - 1)];
+    }
+
+    uint8_t channels() const { return channelCount; }
+    const char* channelName(uint8_t channel) const { return channelNames[channel]; }
+    uint8_t width() const { return valueWidth; }
+};
+
+extern LogicCapture logicCapture;
+
+#endif //LOGIC_CAPTURE_H
@@ -1,10 +1,9 @@
-#include <ESP32Servo.h>
-#include <AccelStepper.h>
 #include <WiFi.h>
 #include "state.h"
 #include "stepper_control.h"
 #include "rfid_control.h"
 #include "web_server.h"
+#include "tag_table.h"
 
 // WiFi configuration
 const char *webServerSSID = "";
@@ -30,7 +29,10 @@ void setup() {
     // Redefine Serial to use Serial1 for all debug output
     #define Serial Serial1
 
-    // Initialize RFID reader
+    // Load the authorized pets before the first tag can be read
+    tagTable.begin();
+
+    // Start the RFID front end selected by RFID_FRONTEND, then the lid servo
     setupRFID();
 
     // Setup stepper motor enable pins
@@ -40,22 +42,30 @@ void setup() {
     digitalWrite(STEPPER_ENA, LOW);
     digitalWrite(STEPPER_ENB, LOW);
 
-    // Configure stepper motor
+    // The coil register masks are built from the STEPPER_GPIO numbers, they must name the STEPPER_PIN pins
+    if (digitalPinToGPIONumber(STEPPER_PIN1) != STEPPER_GPIO1 || digitalPinToGPIONumber(STEPPER_PIN2) != STEPPER_GPIO2 ||
+        digitalPinToGPIONumber(STEPPER_PIN3) != STEPPER_GPIO3 || digitalPinToGPIONumber(STEPPER_PIN4) != STEPPER_GPIO4) {
+        debugPrint("WARNING: STEPPER_GPIO1-4 don't match STEPPER_PIN1-4, check state.h");
+    }
+
+    // Configure stepper motor, steps come from a hardware timer from here on
+    if (!stepper.begin()) {
+        debugPrint("Failed to start the stepper step timer");
+    }
     stepper.setMaxSpeed(500);
     stepper.setAcceleration(200);
-    stepper.setSpeed(200);
 
     // Test stepper motor (small movement)
     debugPrint("Testing stepper motor...");
     enableStepperMotor();
     stepper.move(20);
-    while (stepper.distanceToGo() != 0) {
-        stepper.run();
+    while (stepper.isRunning()) {
+        delay(1);
     }
     delay(500);
     stepper.move(-20);
-    while (stepper.distanceToGo() != 0) {
-        stepper.run();
+    while (stepper.isRunning()) {
+        delay(1);
     }
     delay(500);
     disableStepperMotor();
@@ -113,11 +123,33 @@ void setup() {
     Serial.print(") state: ");
     Serial.println(digitalRead(LED_BUTTON_PIN));
 
+#if RFID_FRONTEND != RFID_FRONTEND_FDXB_UART
+    // Check interrupt pins
+    debugPrint("Checking interrupt pins...");
+    Serial.print("DATA0_PIN (GPIO ");
+    Serial.print(DATA0_PIN);
+    Serial.print(") state: ");
+    Serial.println(digitalRead(DATA0_PIN));
+
+    Serial.print("DATA1_PIN (GPIO ");
+    Serial.print(DATA1_PIN);
+    Serial.print(") state: ");
+    Serial.println(digitalRead(DATA1_PIN));
+#endif
+
     debugPrint("Ready to scan RFID cards");
+#if RFID_FRONTEND == RFID_FRONTEND_FDXB_UART
     debugPrint("Connection: EATAD425 RFID -> Arduino Nano ESP32");
     debugPrint("Red -> 5V");
     debugPrint("Black -> GND");
     debugPrint("TX (from module) -> RX0 on pin 0");
+#else
+    debugPrint("Connection: Grove -> Arduino Nano ESP32");
+    debugPrint("Red -> 5V");
+    debugPrint("Black -> GND");
+    debugPrint("Yellow -> D0 (RX0)");
+    debugPrint("White -> D1 (TX0)");
+#endif
     debugPrint("Servo -> D4");
     debugPrint("LED -> A5");
     debugPrint("LED Button -> D3");
@@ -140,6 +172,10 @@ void setup() {
                 scheduledTasks[i].dayOfWeek);
         debugPrint(taskInfo);
     }
+
+#if RFID_FRONTEND != RFID_FRONTEND_FDXB_UART
+    Serial.println("IMPORTANT: If no interrupts trigger when scanning, try swapping D0/D1");
+#endif
 }
 
 void loop() {
@@ -157,29 +193,14 @@ void loop() {
 
     // Process any incoming RFID data
     processRFIDData();
+    reportLidMoves();
 
-    // Handle stepper motor rotation
-    if (buttonControlActive) {
-        // If button is controlling the stepper, keep it running
-        performSafeModeRotation(0, true);
-    }
-    //TODO: might have broken "every minute" task reset
-    /*else if (stepperRotating) {
-    // Continue running the stepper if a scheduled rotation is in progress
-    if (stepper.distanceToGo() != 0) {
-      stepper.run();
-    } else {
-      // Rotation completed
-      stepperRotating = false;
-      debugPrint("Stepper motor rotation complete");
-      disableStepperMotor(); // Disable motor when rotation is complete
-    }
-  }*/ else if (stepperScheduled && !stepperRotating) {
-        // Start the scheduled rotation
-        startStepperRotation();
+    // Handle stepper motor rotation, a scheduled feeding waits for one in progress
+    if (stepperScheduled && !stepperRotating) {
         stepperScheduled = false;
-        stepperRotating = true;
+        startStepperRotation();
     }
+    updateStepperRotation();
 
     // Check scheduled tasks periodically
     if (currentTime - lastTimeCheck >= TIME_CHECK_INTERVAL) {
@@ -187,5 +208,11 @@ void loop() {
         checkScheduledTasks();
     }
 
-    delay(1000);
+    // Wait for the front end: a millisecond for Wiegand, up to the next line for FDX-B.
+    // While dispensing only yield, so each anti-jam phase follows the last without a gap.
+    if (stepperRotating) {
+        delay(1);
+    } else {
+        rfidFrontEnd.idle();
+    }
 }
@@ -0,0 +1,56 @@
+#include "presence_tracker.h"
+
+PresenceTracker::PresenceTracker(unsigned long initialIntervalMs, unsigned long minTimeoutMs,
+                                 unsigned long maxTimeoutMs, uint8_t arriveReads)
+    : minTimeoutMs(minTimeoutMs), maxTimeoutMs(maxTimeoutMs), arriveReads(arriveReads ? arriveReads : 1),
+      scaledInterval(initialIntervalMs << 3), scaledDeviation(initialIntervalMs << 1),
+      present(false), runReads(0), lastSeen(0) {
+}
+
+// Jacobson/Karels smoothing: gain 1/8 for the mean, 1/4 for the deviation
+void PresenceTracker::learn(unsigned long gapMs) {
+    int32_t error = (int32_t)gapMs - (scaledInterval >> 3);
+    scaledInterval += error;
+    if (error < 0) {
+        error = -error;
+    }
+    scaledDeviation += error - (scaledDeviation >> 2);
+}
+
+unsigned long PresenceTracker::timeout() const {
+    unsigned long timeoutMs = (scaledInterval >> 3) + (PRESENCE_DEVIATIONS * scaledDeviation >> 2);
+    if (timeoutMs < minTimeoutMs) return minTimeoutMs;
+    if (timeoutMs > maxTimeoutMs) return maxTimeoutMs;
+    return timeoutMs;
+}
+
+PresenceEvent PresenceTracker::onRead(unsigned long now) {
+    if (runReads > 0 && now - lastSeen <= timeout()) {
+        // Another repeat of the same visit
+        learn(now - lastSeen);
+        if (runReads < 255) runReads++;
+    } else {
+        runReads = 1;
+    }
+    lastSeen = now;
+
+    if (!present && runReads >= arriveReads) {
+        present = true;
+        return PRESENCE_ARRIVED;
+    }
+    return PRESENCE_NONE;
+}
+
+PresenceEvent PresenceTracker::check(unsigned long now) {
+    if (runReads == 0 || now - lastSeen <= timeout()) {
+        return PRESENCE_NONE;
+    }
+
+    // Nothing read for longer than the reader ever pauses while a tag is in range
+    runReads = 0;
+    if (present) {
+        present = false;
+        return PRESENCE_LEFT;
+    }
+    return PRESENCE_NONE;
+}
@@ -0,0 +1,50 @@
+#ifndef PRESENCE_TRACKER_H
+#define PRESENCE_TRACKER_H
+
+#include <Arduino.h>
+
+#define PRESENCE_DEVIATIONS 4   // Absence is declared this many mean deviations past the usual repeat interval
+
+typedef enum {
+    PRESENCE_NONE,
+    PRESENCE_ARRIVED,
+    PRESENCE_LEFT
+} PresenceEvent;
+
+// Tracks whether a pet is at one reader. Learns how often the reader repeats
+// a tag in range (smoothed mean and mean deviation of the gaps between reads,
+// the way TCP estimates round-trip times) and declares the pet gone once no
+// read has come for mean + PRESENCE_DEVIATIONS * deviation.
+// Hysteresis: arriving takes arriveReads reads in a row, leaving is only
+// declared past the learned timeout, which never drops below minTimeoutMs.
+class PresenceTracker {
+private:
+    const unsigned long minTimeoutMs;
+    const unsigned long maxTimeoutMs;
+    const uint8_t arriveReads;
+
+    // Fixed point: interval scaled by 8, deviation by 4 (as in RFC 6298 implementations)
+    int32_t scaledInterval;
+    int32_t scaledDeviation;
+
+    bool present;
+    uint8_t runReads;           // Reads in the current run, each within the timeout of the previous
+    unsigned long lastSeen;
+
+    void learn(unsigned long gapMs);
+
+public:
+    PresenceTracker(unsigned long initialIntervalMs, unsigned long minTimeoutMs,
+                    unsigned long maxTimeoutMs, uint8_t arriveReads);
+
+    // Feed an authorized read, returns PRESENCE_ARRIVED when the pet is confirmed
+    PresenceEvent onRead(unsigned long now);
+    // Call regularly, returns PRESENCE_LEFT once absence is certain
+    PresenceEvent check(unsigned long now);
+
+    bool isPresent() const { return present; }
+    unsigned long interval() const { return scaledInterval >> 3; }
+    unsigned long timeout() const;
+};
+
+#endif //PRESENCE_TRACKER_H
@@ -0,0 +1,52 @@
+#include "read_stats.h"
+
+ReadStats::ReadStats() {
+    reset(0);
+}
+
+void ReadStats::reset(unsigned long now) {
+    since = now;
+    decodedFrames = 0;
+    parityFailures = 0;
+    truncatedFrames = 0;
+    overlongFrames = 0;
+    memset(bitCounts, 0, sizeof(bitCounts));
+    cardCount = 0;
+}
+
+// card is NULL when the frame failed to decode
+void ReadStats::recordFrame(int bitCount, const WiegandCard* card, unsigned long now) {
+    bitCounts[bitCount <= WIEGAND_MAX_BITS ? bitCount : WIEGAND_MAX_BITS + 1]++;
+
+    if (card != NULL) {
+        decodedFrames++;
+        recordCard(card->id, now);
+    } else if (bitCount > WIEGAND_LONGEST_FORMAT) {
+        overlongFrames++;
+    } else if (isWiegandFrameLength(bitCount)) {
+        parityFailures++;
+    } else {
+        truncatedFrames++;
+    }
+}
+
+void ReadStats::recordCard(uint64_t cardId, unsigned long now) {
+    int oldest = 0;
+    for (int i = 0; i < cardCount; i++) {
+        if (cards[i].cardId == cardId) {
+            cards[i].reads++;
+            cards[i].lastRead = now;
+            return;
+        }
+        if (cards[i].lastRead < cards[oldest].lastRead) {
+            oldest = i;
+        }
+    }
+
+    // New card - take a free entry, or the least recently read one
+    int slot = cardCount < READ_STATS_CARDS ? cardCount++ : oldest;
+    cards[slot].cardId = cardId;
+    cards[slot].reads = 1;
+    cards[slot].firstRead = now;
+    cards[slot].lastRead = now;
+}
@@ -0,0 +1,51 @@
+#ifndef READ_STATS_H
+#define READ_STATS_H
+
+#include <Arduino.h>
+#include "wiegand_reader.h"
+
+#define READ_STATS_CARDS 8   // Cards whose read rate is tracked per reader, least recently read is replaced
+
+// Read counts of one card
+typedef struct {
+    uint64_t cardId;
+    uint32_t reads;
+    unsigned long firstRead;
+    unsigned long lastRead;
+} CardReadStats;
+
+// Read-quality counters of one reader, kept to spot failing antennas.
+// Recording a frame is a handful of increments, cheap enough for every frame.
+class ReadStats {
+private:
+    unsigned long since;           // millis() at the last reset
+    uint32_t decodedFrames;
+    uint32_t parityFailures;       // Supported length, bad parity
+    uint32_t truncatedFrames;      // Unsupported length shorter than the longest format
+    uint32_t overlongFrames;       // Longer than the longest format
+    uint32_t bitCounts[WIEGAND_MAX_BITS + 2];  // Histogram of frame lengths, last bin counts longer frames
+
+    CardReadStats cards[READ_STATS_CARDS];
+    int cardCount;
+
+    void recordCard(uint64_t cardId, unsigned long now);
+
+public:
+    ReadStats();
+
+    void recordFrame(int bitCount, const WiegandCard* card, unsigned long now);
+    void reset(unsigned long now);
+
+    unsigned long startTime() const { return since; }
+    uint32_t decoded() const { return decodedFrames; }
+    uint32_t parityFailed() const { return parityFailures; }
+    uint32_t truncated() const { return truncatedFrames; }
+    uint32_t overlong() const { return overlongFrames; }
+    // Frames of bitCount bits, WIEGAND_MAX_BITS + 1 for longer ones
+    uint32_t framesOfLength(int bitCount) const { return bitCounts[bitCount]; }
+
+    int trackedCards() const { return cardCount; }
+    const CardReadStats& card(int i) const { return cards[i]; }
+};
+
+#endif //READ_STATS_H
@@ -0,0 +1,41 @@
+#include "recent_reads.h"
+
+RecentReads::RecentReads(unsigned long refreshWindowMs)
+    : count(0), windowMs(refreshWindowMs), eventCount(0), repeatCount(0) {
+}
+
+bool RecentReads::seen(uint64_t tagId, uint8_t reader, unsigned long now) {
+    int i = 0;
+    while (i < count && !(entries[i].tagId == tagId && entries[i].reader == reader)) {
+        i++;
+    }
+
+    bool repeat = i < count && now - entries[i].lastSeen <= windowMs;
+
+    if (i == count) {
+        // New tag - take a free slot, or the least recently seen one
+        if (count < RECENT_READS_SIZE) {
+            count++;
+        }
+        i = count - 1;
+    }
+
+    // Move to the front
+    for (; i > 0; i--) {
+        entries[i] = entries[i - 1];
+    }
+    entries[0].tagId = tagId;
+    entries[0].reader = reader;
+    entries[0].lastSeen = now;
+
+    if (repeat) {
+        repeatCount++;
+    } else {
+        eventCount++;
+    }
+    return repeat;
+}
+
+void RecentReads::clear() {
+    count = 0;
+}
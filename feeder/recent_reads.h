@@ -0,0 +1,39 @@
+#ifndef RECENT_READS_H
+#define RECENT_READS_H
+
+#include <Arduino.h>
+
+#define RECENT_READS_SIZE 8   // Tags remembered at once, the least recently seen is evicted
+
+// Small LRU of recently read tags. Readers repeat a tag many times a second
+// while a pet stands at the bowl; only the first sighting of a tag, or one
+// after it has been gone longer than the refresh window, counts as an event.
+class RecentReads {
+private:
+    typedef struct {
+        uint64_t tagId;
+        uint8_t reader;
+        unsigned long lastSeen;
+    } RecentRead;
+
+    RecentRead entries[RECENT_READS_SIZE];  // Most recently seen first
+    int count;
+    unsigned long windowMs;
+
+    uint32_t eventCount;
+    uint32_t repeatCount;
+
+public:
+    explicit RecentReads(unsigned long refreshWindowMs);
+
+    // Record a read. Returns true for a repeat within the refresh window.
+    bool seen(uint64_t tagId, uint8_t reader, unsigned long now);
+    void clear();
+
+    void setWindow(unsigned long refreshWindowMs) { windowMs = refreshWindowMs; }
+    unsigned long window() const { return windowMs; }
+    uint32_t events() const { return eventCount; }
+    uint32_t repeats() const { return repeatCount; }
+};
+
+#endif //RECENT_READS_H
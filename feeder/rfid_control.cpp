@@ -0,0 +1,250 @@
+#include "rfid_control.h"
+#include "tag_table.h"
+
+// RFID variables
+unsigned long lastReadTime = 0;
+unsigned long currentTime = 0;
+RecentReads recentReads(RECENT_READ_WINDOW_MS);
+
+// button control
+boolean servoButtonPressed = false;
+boolean lastButtonState = HIGH; // Assuming using pull-up resistor
+boolean buttonState = HIGH; // Current debounced button state
+unsigned long lastButtonDebounceTime = 0;
+const unsigned long buttonDebounceDelay = 50; // 50ms debounce
+
+// Servo control
+LedcServo myServo(LID_SERVO_CHANNEL, LID_SERVO_TIMER);
+boolean tagPresent = false; // Lid opened for a pet that is still present
+#if RFID_FRONTEND == RFID_FRONTEND_FDXB_UART
+// The FDX-B feeder mounts the servo the other way round, with 90 degrees of lid travel
+const int SERVO_OPEN_POS = 0; // Position for servo when tag detected (0-90)
+const int SERVO_CLOSED_POS = 90; // Position for servo when no tag detected (0-90)
+#else
+const int SERVO_OPEN_POS = 180; // Position for servo when tag detected (0-180)
+const int SERVO_CLOSED_POS = 0; // Position for servo when no tag detected (0-180)
+#endif
+
+// Eased lid motion, advanced in the background by its update timer
+ServoTrajectory lidMotion(myServo, abs(SERVO_OPEN_POS - SERVO_CLOSED_POS));
+
+// Lid and LED owner, everything else posts intents to it
+static const LidAction lidOpenAction = { SERVO_OPEN_POS, LID_OPEN_TIME_MS, LID_OPEN_PROFILE, true };
+static const LidAction lidCloseAction = { SERVO_CLOSED_POS, LID_CLOSE_TIME_MS, LID_CLOSE_PROFILE, false };
+LidArbiter lidArbiter(lidMotion, LED_PIN, lidOpenAction, lidCloseAction);
+
+void setupRFID() {
+    // Start capture on every reader of the selected front end
+    if (!rfidFrontEnd.begin()) {
+        debugPrint("Failed to start the RFID front end");
+    }
+
+    pinMode(SERVO_PIN, OUTPUT);
+    pinMode(LED_PIN, OUTPUT); // Set LED pin as output
+    pinMode(LED_BUTTON_PIN, INPUT_PULLUP); // Button with pull-up
+
+    // Turn off LED initially
+    digitalWrite(LED_PIN, LOW);
+
+    // Setup servo
+    static const ServoCalibration lidCalibration = { LID_SERVO_MIN_US, LID_SERVO_MAX_US, LID_SERVO_RANGE_DEG };
+    myServo.setIdleOff(LID_SERVO_IDLE_OFF_MS, LID_SERVO_POWER_PIN); // No hum or holding current while the lid rests
+    if (!myServo.begin(SERVO_PIN, lidCalibration, LID_SERVO_REFRESH_HZ, SERVO_CLOSED_POS)) {
+        debugPrint("Failed to start the servo LEDC channel");
+    }
+    // Start in closed position, updated once per servo frame
+    if (!lidMotion.begin(SERVO_CLOSED_POS, 1000000 / LID_SERVO_REFRESH_HZ)) {
+        debugPrint("Failed to start the servo update timer");
+    }
+
+    debugPrint("RFID Reader for Arduino Nano ESP32 with Servo and AccelStepper - Starting up...");
+
+    // Test LED to indicate startup
+    for (int i = 0; i < 3; i++) {
+        digitalWrite(LED_PIN, HIGH);
+        delay(200);
+        digitalWrite(LED_PIN, LOW);
+        delay(200);
+    }
+
+    // Test servo movement
+    debugPrint("Testing servo...");
+    lidMotion.moveTo(SERVO_OPEN_POS, 3000);
+    while (lidMotion.isMoving()) delay(10);
+    delay(500);
+    lidMotion.moveTo(SERVO_CLOSED_POS, 3000);
+    while (lidMotion.isMoving()) delay(10);
+    delay(500);
+
+    // From here on the lid and LED only move through the arbiter
+    if (!lidArbiter.begin()) {
+        debugPrint("Failed to start the lid arbiter");
+    }
+}
+
+// Feed an authorized read to the reader's presence tracker, open the lid once the pet has arrived
+static void trackAuthorizedRead(PresenceTracker& presence, uint8_t readerIndex) {
+    if (presence.onRead(millis()) != PRESENCE_ARRIVED) {
+        return;
+    }
+
+    Serial.print("Pet arrived at reader ");
+    Serial.println(readerIndex);
+
+    // Open with the LED on, unless the button holds the lid
+    tagPresent = true;
+    lidArbiter.post(LID_SOURCE_TAG, LID_INTENT_OPEN);
+}
+
+// Act on one read of the front end. Written against the front end policy
+// (rfid_frontend.h) and instantiated for RfidFrontEnd only.
+// Returns true for the first read of a tag's visit.
+template <class FrontEnd>
+static boolean handleTagRead(FrontEnd& frontEnd, const TagRead& read) {
+    if (!read.valid) {
+        // The tag can't be identified, so the lid stays closed
+        debugPrint("==========================================");
+        frontEnd.printRead(read);
+        debugPrint("ERROR: Invalid or incomplete read ignored!");
+        debugPrint("==========================================");
+        return false;
+    }
+
+    boolean allowed = tagTable.isAllowed(read.tagId, read.reader);
+    currentTime = millis();
+
+    // Repeats of a tag that is already at the bowl only feed its presence
+    if (recentReads.seen(read.tagId, read.reader, currentTime)) {
+        if (allowed) {
+            lastReadTime = currentTime;
+            trackAuthorizedRead(frontEnd.presence(read.reader), read.reader);
+        }
+        return false;
+    }
+
+    // First read of this tag, log the read
+    debugPrint("==========================================");
+    debugPrint("RFID Tag detected");
+    frontEnd.printRead(read);
+
+    // Calculate and display time since last read
+    if (lastReadTime > 0) {
+        Serial.print("Time since last read: ");
+        Serial.print((currentTime - lastReadTime) / 1000.0);
+        Serial.println(" seconds");
+    }
+    lastReadTime = currentTime;
+
+    // Only pets allowed at this reader's bowl open the lid
+    const PetEntry* pet = tagTable.lookup(read.tagId);
+    Serial.print("Pet: ");
+    Serial.println(pet ? pet->name : "(unknown)");
+
+    if (!allowed) {
+        debugPrint("Tag not authorized for this bowl - lid stays closed");
+    } else {
+        trackAuthorizedRead(frontEnd.presence(read.reader), read.reader);
+    }
+
+    debugPrint("==========================================");
+    return true;
+}
+
+// Drain every finished read of the front end, then update presence
+template <class FrontEnd>
+static boolean pollTagReads(FrontEnd& frontEnd) {
+    boolean newTagRead = false;
+
+    TagRead read;
+    while (frontEnd.nextRead(read)) {
+        newTagRead |= handleTagRead(frontEnd, read);
+    }
+
+    // Update presence from each reader's learned repeat interval
+    bool anyPetPresent = false;
+    for (int r = 0; r < frontEnd.readerCount(); r++) {
+        PresenceTracker& presence = frontEnd.presence(r);
+        if (presence.check(millis()) == PRESENCE_LEFT) {
+            Serial.print("Pet left reader ");
+            Serial.print(r);
+            Serial.print(" - repeat interval ");
+            Serial.print(presence.interval());
+            Serial.print(" ms, timeout ");
+            Serial.print(presence.timeout());
+            Serial.println(" ms");
+        }
+        anyPetPresent = anyPetPresent || presence.isPresent();
+    }
+
+    // Withdraw the open request once no reader sees an authorized pet any more,
+    // the lid closes unless the button still holds it open
+    if (tagPresent && !anyPetPresent) {
+        tagPresent = false;
+        lidArbiter.post(LID_SOURCE_TAG, LID_INTENT_NONE);
+        debugPrint("Tag removed - Servo closing");
+    }
+
+    return newTagRead;
+}
+
+// Handle the reads of the selected front end. Returns true if a new tag was read.
+boolean processRFIDData() {
+    return pollTagReads(rfidFrontEnd);
+}
+
+// Log lid moves from loop(). The arbiter moves the lid from its control tick,
+// which must not block on Serial, so it only counts them.
+void reportLidMoves() {
+    static uint32_t reported = 0;
+    uint32_t actuations = lidArbiter.actuationCount();
+    if (actuations == reported) {
+        return;
+    }
+    reported = actuations;
+
+    Serial.print(lidArbiter.isOpen() ? "Lid opening to " : "Lid closing to ");
+    Serial.print(lidMotion.targetMicros());
+    Serial.print(" us, move ");
+    Serial.println(actuations);
+}
+
+// Check button state with debounce
+void checkServoButton() {
+    // Read current button state
+    int reading = digitalRead(LED_BUTTON_PIN);
+
+    // Check if button state has changed
+    if (reading != lastButtonState) {
+        // Reset debounce timer
+        lastButtonDebounceTime = millis();
+    }
+
+    // If enough time has passed since last state change
+    if ((millis() - lastButtonDebounceTime) > buttonDebounceDelay) {
+        // If button state has actually changed
+        if (reading != buttonState) {
+            buttonState = reading;
+
+            // Button is pressed (LOW when using INPUT_PULLUP)
+            if (buttonState == LOW) {
+                servoButtonPressed = true;
+                // Open servo, LED on
+                lidArbiter.post(LID_SOURCE_BUTTON, LID_INTENT_OPEN);
+
+                debugPrint("Button pressed - Servo opening, LED on");
+            }
+            // Button is released
+            else {
+                servoButtonPressed = false;
+                // Hand the lid back, it closes unless a pet is still at the bowl
+                lidArbiter.post(LID_SOURCE_BUTTON, LID_INTENT_NONE);
+
+                debugPrint(tagPresent ? "Button released - pet present, lid stays open"
+                                      : "Button released - Servo closing, LED off");
+            }
+        }
+    }
+
+    // Save current reading for next comparison
+    lastButtonState = reading;
+}
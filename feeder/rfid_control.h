@@ -0,0 +1,62 @@
+#ifndef RFID_CONTROL_H
+#define RFID_CONTROL_H
+
+#include <Arduino.h>
+#include "state.h"
+#include "rfid_frontend.h"
+#include "recent_reads.h"
+#include "presence_tracker.h"
+#include "servo_trajectory.h"
+#include "lid_arbiter.h"
+
+// Tag handling, tuned to how often the selected front end repeats a tag.
+// Presence detection is tuned with the readers, in the front end header.
+#if RFID_FRONTEND == RFID_FRONTEND_FDXB_UART
+#define RECENT_READ_WINDOW_MS 5000 // Repeats of a tag closer together than this are one visit
+#else
+#define RECENT_READ_WINDOW_MS 2000 // Repeats of a tag closer together than this are one visit
+#endif
+
+// Lid servo on the LEDC peripheral, calibrated endpoints of this servo
+#define LID_SERVO_MIN_US 500             // Pulse at 0 degrees
+#define LID_SERVO_MAX_US 2400            // Pulse at LID_SERVO_RANGE_DEG
+#define LID_SERVO_RANGE_DEG 180
+#define LID_SERVO_REFRESH_HZ 50          // 50 for analog servos, digital ones accept up to 333
+#define LID_SERVO_CHANNEL LEDC_CHANNEL_0
+#define LID_SERVO_TIMER LEDC_TIMER_0
+#define LID_SERVO_IDLE_OFF_MS 1500       // Stop pulsing once the lid has rested this long, 0 to always hold
+#define LID_SERVO_POWER_PIN -1           // GPIO switching the servo supply, -1 if it is always powered
+#define LID_SERVO_HOLD_MW 250            // Estimated draw while holding still, for the energy statistics
+
+// Lid motion, times are for the full travel between closed and open
+#define LID_OPEN_TIME_MS 2500          // Opening for a pet
+#define LID_OPEN_PROFILE EASE_MIN_JERK // No jolt at either end, gentle for skittish pets
+#define LID_CLOSE_TIME_MS 1500         // Closing once the pet has left
+#define LID_CLOSE_PROFILE EASE_TRAPEZOID
+
+// RFID variables
+extern unsigned long lastReadTime;
+extern unsigned long currentTime;
+extern RecentReads recentReads;          // Suppresses repeated reads of the same tag
+
+// button control
+extern boolean servoButtonPressed;
+extern boolean lastButtonState;
+extern boolean buttonState;
+extern unsigned long lastButtonDebounceTime;
+extern const unsigned long buttonDebounceDelay;
+
+// Servo control
+extern LedcServo myServo;
+extern ServoTrajectory lidMotion;
+extern LidArbiter lidArbiter;           // Owns the lid and LED after setupRFID()
+extern boolean tagPresent;
+extern const int SERVO_OPEN_POS;
+extern const int SERVO_CLOSED_POS;
+
+void setupRFID();
+boolean processRFIDData();
+void checkServoButton();
+void reportLidMoves();
+
+#endif //RFID_CONTROL_H
@@ -0,0 +1,30 @@
+#ifndef RFID_FRONTEND_H
+#define RFID_FRONTEND_H
+
+#include <Arduino.h>
+#include "state.h"
+#include "tag_read.h"
+
+// The RFID front end is a policy class chosen by RFID_FRONTEND. The tag
+// handling in rfid_control.cpp is written against this interface and
+// instantiated for the selected class only, so every call resolves at
+// compile time:
+//
+//   bool begin();                        // Start capture on every reader
+//   int readerCount() const;
+//   bool nextRead(TagRead& read);        // Take the next finished read, false once drained
+//   void printRead(const TagRead& read); // Log the raw data and decoded fields of the last read
+//   void idle();                         // Wait in loop() until there may be work
+//   void resetStats();
+//   PresenceTracker& presence(int i);    // Whether an authorized pet is at reader i
+#if RFID_FRONTEND == RFID_FRONTEND_FDXB_UART
+#include "fdxb_frontend.h"
+typedef FdxbUartFrontEnd RfidFrontEnd;
+#else
+#include "wiegand_frontend.h"
+typedef WiegandFrontEnd RfidFrontEnd;
+#endif
+
+extern RfidFrontEnd rfidFrontEnd;
+
+#endif //RFID_FRONTEND_H
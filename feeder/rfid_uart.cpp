@@ -0,0 +1,156 @@
+#include "rfid_uart.h"
+
+RfidUart rfidUart;
+
+RfidUart::RfidUart() : eventQueue(NULL), lineQueue(NULL) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool RfidUart::begin(int rxPin, int txPin) {
+    uart_config_t config = {};
+    config.baud_rate = RFID_UART_BAUD;
+    config.data_bits = UART_DATA_8_BITS;
+    config.parity = UART_PARITY_DISABLE;
+    config.stop_bits = UART_STOP_BITS_1;
+    config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+    config.source_clk = UART_SCLK_DEFAULT;
+
+    if (uart_driver_install(RFID_UART_PORT, RFID_UART_RX_BUFFER, 0, RFID_UART_EVENT_QUEUE, &eventQueue, 0) != ESP_OK) {
+        return false;
+    }
+    uart_param_config(RFID_UART_PORT, &config);
+    // Arduino pins, as Serial2.begin() took them: D0/D1 are GPIO44/43 on the Nano ESP32
+    uart_set_pin(RFID_UART_PORT, digitalPinToGPIONumber(txPin), digitalPinToGPIONumber(rxPin), UART_PIN_NO_CHANGE,
+                 UART_PIN_NO_CHANGE);
+
+    // One terminator character completes a line, no idle time needed around it
+    uart_enable_pattern_det_baud_intr(RFID_UART_PORT, RFID_LINE_TERMINATOR, 1, 9, 0, 0);
+    uart_pattern_queue_reset(RFID_UART_PORT, RFID_UART_PATTERN_QUEUE);
+
+    lineQueue = xQueueCreate(RFID_LINE_QUEUE, sizeof(RfidLine));
+    if (lineQueue == NULL) {
+        return false;
+    }
+    return xTaskCreatePinnedToCore(rxTask, "rfidRx", RFID_RX_TASK_STACK, this,
+                                   RFID_RX_TASK_PRIORITY, NULL, RFID_RX_TASK_CORE) == pdPASS;
+}
+
+// Sleeps on the driver's event queue and turns every detected line end into a queued line
+void RfidUart::rxTask(void* arg) {
+    RfidUart* uart = (RfidUart*)arg;
+    uart_event_t event;
+    for (;;) {
+        if (xQueueReceive(uart->eventQueue, &event, portMAX_DELAY) == pdTRUE) {
+            uart->handleEvent(event);
+        }
+    }
+}
+
+void RfidUart::handleEvent(const uart_event_t& event) {
+    switch (event.type) {
+        case UART_PATTERN_DET: {
+            RfidLine line;
+            line.endMicros = micros();
+            int length = readDriverLine(line.text, sizeof(line.text));
+            if (length == 0) {
+                break;
+            }
+            line.length = length;
+            if (xQueueSend(lineQueue, &line, 0) == pdTRUE) {
+                stats.lines++;
+            } else {
+                stats.droppedLines++;
+            }
+            break;
+        }
+        case UART_FIFO_OVF:
+            // Bytes were lost, so the buffered partial line can't be trusted
+            stats.fifoOverflows++;
+            uart_flush_input(RFID_UART_PORT);
+            uart_pattern_queue_reset(RFID_UART_PORT, RFID_UART_PATTERN_QUEUE);
+            break;
+        case UART_BUFFER_FULL:
+            stats.bufferOverflows++;
+            uart_flush_input(RFID_UART_PORT);
+            uart_pattern_queue_reset(RFID_UART_PORT, RFID_UART_PATTERN_QUEUE);
+            break;
+        case UART_FRAME_ERR:
+            // The corrupted byte stays in the line and fails to decode there
+            stats.framingErrors++;
+            break;
+        case UART_PARITY_ERR:
+            stats.parityErrors++;
+            break;
+        default:
+            // Plain data is read once its line is complete
+            break;
+    }
+}
+
+// Read the line whose terminator the driver reported, straight from the driver ring
+int RfidUart::readDriverLine(char* buffer, int maxLength) {
+    int position = uart_pattern_pop_pos(RFID_UART_PORT);
+    if (position < 0) {
+        // The driver's pattern queue overflowed, fall back to whatever is buffered
+        size_t buffered = 0;
+        uart_get_buffered_data_len(RFID_UART_PORT, &buffered);
+        position = (int)buffered - 1;
+        if (position < 0) {
+            return 0;
+        }
+    }
+
+    // The line is position bytes plus the terminator
+    int lineLength = position + 1;
+    int stored = lineLength < maxLength - 1 ? lineLength : maxLength - 1;
+    uart_read_bytes(RFID_UART_PORT, (uint8_t*)buffer, stored, 0);
+
+    // Drop what did not fit, the terminator is kept as the last byte
+    char discard[16];
+    for (int remaining = lineLength - stored; remaining > 0; ) {
+        int chunk = remaining < (int)sizeof(discard) ? remaining : sizeof(discard);
+        uart_read_bytes(RFID_UART_PORT, (uint8_t*)discard, chunk, 0);
+        remaining -= chunk;
+        buffer[stored - 1] = discard[chunk - 1];
+    }
+    buffer[stored] = 0;
+
+    // A LF left over from the previous CR LF starts this line, skip it
+    int start = 0;
+    while (start < stored && (buffer[start] == '\r' || buffer[start] == '\n')) {
+        start++;
+    }
+    if (start == stored) {
+        return 0; // Only terminators
+    }
+    if (start > 0) {
+        memmove(buffer, buffer + start, stored - start + 1);
+    }
+    return stored - start;
+}
+
+bool RfidUart::waitForLine(TickType_t timeout) {
+    RfidLine line;
+    return xQueuePeek(lineQueue, &line, timeout) == pdTRUE;
+}
+
+int RfidUart::readLine(char* buffer, int maxLength, uint32_t& endMicros) {
+    RfidLine line;
+    if (xQueueReceive(lineQueue, &line, 0) != pdTRUE) {
+        return 0;
+    }
+
+    int length = line.length < maxLength - 1 ? line.length : maxLength - 1;
+    memcpy(buffer, line.text, length);
+    if (length < line.length) {
+        buffer[length - 1] = line.text[line.length - 1]; // Keep the terminator
+    }
+    buffer[length] = 0;
+    endMicros = line.endMicros;
+    return length;
+}
+
+uint32_t RfidUart::errorCount() const {
+    return stats.droppedLines + stats.fifoOverflows + stats.bufferOverflows
+         + stats.framingErrors + stats.parityErrors;
+}
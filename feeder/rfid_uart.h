@@ -0,0 +1,70 @@
+#ifndef RFID_UART_H
+#define RFID_UART_H
+
+#include <Arduino.h>
+#include <driver/uart.h>
+
+#define RFID_UART_PORT UART_NUM_2     // Same UART the module used as Serial2
+#define RFID_UART_BAUD 9600
+#define RFID_UART_BYTE_US 1042        // One 8N1 character at 9600 baud
+#define RFID_UART_RX_BUFFER 4096      // Driver RX ring, minutes of reader output at 9600 baud
+#define RFID_UART_EVENT_QUEUE 32      // UART events waiting for the RX task
+#define RFID_UART_PATTERN_QUEUE 32    // Line ends remembered by the driver
+#define RFID_LINE_TERMINATOR '\r'     // The module ends every line with CR (a LF may follow)
+#define RFID_LINE_MAX 48              // Longest line kept, fits a raw telegram (32 hex digits) and its terminator
+
+#define RFID_LINE_QUEUE 32            // Complete lines waiting for loop()
+#define RFID_RX_TASK_STACK 3072
+#define RFID_RX_TASK_PRIORITY 5       // Above loop(), so reads keep flowing while it blocks
+#define RFID_RX_TASK_CORE 0           // loop() runs on core 1
+
+// One complete line from the module
+typedef struct {
+    char text[RFID_LINE_MAX];   // Terminator included, NUL-terminated
+    uint8_t length;
+    uint32_t endMicros;         // micros() when the driver reported the terminator
+} RfidLine;
+
+// Receive problems since boot
+typedef struct {
+    uint32_t lines;             // Lines queued for loop()
+    uint32_t droppedLines;      // Line queue full, loop() fell too far behind
+    uint32_t fifoOverflows;     // Hardware FIFO overflowed before the driver emptied it
+    uint32_t bufferOverflows;   // Driver RX ring full
+    uint32_t framingErrors;
+    uint32_t parityErrors;
+} RfidUartStats;
+
+// The RFID module's UART through the ESP-IDF driver. The driver detects the
+// line terminator in hardware, a dedicated task collects complete lines into
+// a queue, so reads are buffered however long loop() is busy moving motors.
+class RfidUart {
+private:
+    QueueHandle_t eventQueue;
+    QueueHandle_t lineQueue;
+    RfidUartStats stats;
+
+    static void rxTask(void* arg);
+    void handleEvent(const uart_event_t& event);
+    int readDriverLine(char* buffer, int maxLength);
+
+public:
+    RfidUart();
+
+    bool begin(int rxPin, int txPin);
+
+    // Sleep until a line is waiting, or timeout. Returns true if a line is ready.
+    bool waitForLine(TickType_t timeout);
+
+    // Take the next complete line into buffer, terminator included and
+    // NUL-terminated. Returns the stored length, 0 if no line is waiting.
+    int readLine(char* buffer, int maxLength, uint32_t& endMicros);
+
+    const RfidUartStats& getStats() const { return stats; }
+    void resetStats() { memset(&stats, 0, sizeof(stats)); }
+    uint32_t errorCount() const;
+};
+
+extern RfidUart rfidUart;
+
+#endif //RFID_UART_H
@@ -0,0 +1,112 @@
+#include "servo_trajectory.h"
+
+ServoTrajectory::ServoTrajectory(LedcServo& servo, int fullRange)
+    : servo(servo), fullRange(fullRange), fullRangeUs(0), updateTimer(NULL),
+      startPosition(0), targetPosition(0), startTime(0), duration(0), timeScale(0),
+      profile(EASE_QUADRATIC), moving(false), lastWritten(-1) {
+    portMUX_INITIALIZE(&lock);
+}
+
+void ServoTrajectory::onUpdate(void* arg) {
+    ((ServoTrajectory*)arg)->tick();
+}
+
+bool ServoTrajectory::begin(float degrees, uint32_t updateUs) {
+    fullRangeUs = abs(servo.degreesToMicros(fullRange) - servo.degreesToMicros(0));
+
+    int position = servo.degreesToMicros(degrees);
+    startPosition = position;
+    targetPosition = position;
+    moving = false;
+    servo.writeMicroseconds(position);
+    lastWritten = position;
+
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = onUpdate;
+    timerArgs.arg = this;
+    timerArgs.name = "servoTrajectory";
+    if (esp_timer_create(&timerArgs, &updateTimer) != ESP_OK) {
+        return false;
+    }
+    return esp_timer_start_periodic(updateTimer, updateUs) == ESP_OK;
+}
+
+// Position along the current move. Call with the lock held.
+int ServoTrajectory::positionAt(unsigned long now) const {
+    if (!moving) {
+        return targetPosition;
+    }
+
+    unsigned long elapsed = now - startTime;
+    if (elapsed >= duration) {
+        return targetPosition;
+    }
+
+    uint32_t t = (uint32_t)(((uint64_t)elapsed * timeScale) >> 16);  // Q16 normalized time
+    int32_t distance = targetPosition - startPosition;
+    return startPosition + ((distance * easeFixed(profile, t) + 32768) >> 16);
+}
+
+void ServoTrajectory::moveTo(float degrees, int fullRangeTime, EasingProfile newProfile) {
+    int newTarget = servo.degreesToMicros(degrees);
+
+    // Time is taken under the lock, so tick() never sees a start time ahead of its own
+    portENTER_CRITICAL(&lock);
+    unsigned long now = millis();
+
+    // Start from wherever the servo is now, also in the middle of a move
+    int from = positionAt(now);
+    int distance = abs(newTarget - from);
+
+    // Calculate proportional movement time based on distance relative to full range
+    unsigned long moveTime = fullRangeUs > 0 ? (unsigned long)distance * fullRangeTime / fullRangeUs : 0;
+
+    // Ensure minimum movement time for very small movements
+    if (moveTime < SERVO_MIN_MOVE_MS && distance > 0) moveTime = SERVO_MIN_MOVE_MS;
+
+    startPosition = from;
+    targetPosition = newTarget;
+    startTime = now;
+    duration = moveTime;
+    timeScale = moveTime > 0 ? (uint32_t)((1ULL << 32) / moveTime) : 0;
+    profile = newProfile;
+    moving = distance > 0;
+    portEXIT_CRITICAL(&lock);
+}
+
+void ServoTrajectory::tick() {
+    portENTER_CRITICAL(&lock);
+    unsigned long now = millis();
+    int stepPosition = positionAt(now);
+    if (moving && now - startTime >= duration) {
+        // Ensure we end exactly at the target position
+        moving = false;
+    }
+    portEXIT_CRITICAL(&lock);
+
+    // Only write when the pulse width changes, the servo holds its last one
+    if (stepPosition != lastWritten) {
+        servo.writeMicroseconds(stepPosition);
+        lastWritten = stepPosition;
+    } else {
+        servo.checkIdle();
+    }
+}
+
+bool ServoTrajectory::isMoving() const {
+    portENTER_CRITICAL(&lock);
+    bool result = moving;
+    portEXIT_CRITICAL(&lock);
+    return result;
+}
+
+int ServoTrajectory::positionMicros() const {
+    portENTER_CRITICAL(&lock);
+    int result = positionAt(millis());
+    portEXIT_CRITICAL(&lock);
+    return result;
+}
+
+int ServoTrajectory::targetMicros() const {
+    return targetPosition;
+}
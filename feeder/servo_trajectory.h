@@ -0,0 +1,56 @@
+#ifndef SERVO_TRAJECTORY_H
+#define SERVO_TRAJECTORY_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "ledc_servo.h"
+#include "easing_table.h"
+
+#define SERVO_UPDATE_US 20000   // Default trajectory update period, one 50Hz servo frame
+#define SERVO_MIN_MOVE_MS 20    // Shortest move, so small corrections still ease
+
+// Eased servo motion that runs in the background. moveTo() only sets the
+// target, a periodic esp_timer advances the servo along the chosen profile
+// (easing_table.h) with integer math only, so loop() never waits for the lid.
+// Positions are interpolated in pulse microseconds, not whole degrees.
+// A new moveTo() during a move starts from wherever the servo is at that moment.
+class ServoTrajectory {
+private:
+    LedcServo& servo;
+    const int fullRange;             // Degrees a fullRangeTime move covers
+    int fullRangeUs;                 // The same distance in pulse width
+    esp_timer_handle_t updateTimer;
+    mutable portMUX_TYPE lock;       // Shared with the esp_timer task
+
+    // Move in progress, pulse widths in microseconds
+    int startPosition;
+    int targetPosition;
+    unsigned long startTime;         // millis() when the move started
+    unsigned long duration;          // ms
+    uint32_t timeScale;              // 2^32 / duration, turns elapsed ms into Q16 move time
+    EasingProfile profile;
+    bool moving;
+    int lastWritten;                 // Last pulse width sent to the servo
+
+    static void onUpdate(void* arg);
+    int positionAt(unsigned long now) const;
+
+public:
+    ServoTrajectory(LedcServo& servo, int fullRange);
+
+    // Write the starting angle and start the update timer, after servo.begin().
+    // Update once per servo frame, faster updates are never seen by the servo.
+    bool begin(float degrees, uint32_t updateUs = SERVO_UPDATE_US);
+
+    // Move to an angle along profile, taking fullRangeTime ms per fullRange degrees
+    void moveTo(float degrees, int fullRangeTime, EasingProfile profile = EASE_QUADRATIC);
+
+    // Advance along the profile, called by the update timer
+    void tick();
+
+    bool isMoving() const;
+    int positionMicros() const;
+    int targetMicros() const;
+};
+
+#endif //SERVO_TRAJECTORY_H
@@ -0,0 +1,45 @@
+#ifndef STATE_H
+#define STATE_H
+
+#include <Arduino.h>
+
+#define DEBUG 1              // Set to 1 to enable debug messages, 0 to disable
+#define DATA0_PIN 0          // Data0 pin (RX0 on D0)
+#define DATA1_PIN 1          // Data1 pin (TX0 on D1)
+#define SERVO_PIN 4          // Servo motor connected to D4
+#define LED_BUTTON_PIN 3     // Servo Button connected to D3
+#define LED_PIN A5           // LED connected to A5
+
+// Stepper motor pins
+#define STEPPER_PIN1 8       // NEMA 17 stepper motor pin IN1
+#define STEPPER_PIN2 9       // NEMA 17 stepper motor pin IN2
+#define STEPPER_PIN3 10      // NEMA 17 stepper motor pin IN3
+#define STEPPER_PIN4 11      // NEMA 17 stepper motor pin IN4
+#define STEPPER_GPIO1 17     // The same pins as GPIO numbers, for the coil register masks (Nano ESP32 D8)
+#define STEPPER_GPIO2 18     // D9
+#define STEPPER_GPIO3 21     // D10
+#define STEPPER_GPIO4 38     // D11
+#define STEPPER_ENA 6        // ENA pin for L298N driver
+#define STEPPER_ENB 7        // ENB pin for L298N driver
+#define STEPPER_BUTTON_PIN 2 // Stepper Button connected to D2
+
+// RFID front end, selected at compile time (rfid_frontend.h)
+#define RFID_FRONTEND_WIEGAND_ISR 0  // Wiegand readers, one GPIO interrupt per bit
+#define RFID_FRONTEND_WIEGAND_RMT 1  // Wiegand readers, RMT peripheral records whole pulse trains
+#define RFID_FRONTEND_FDXB_UART 2    // ISO 11784/11785 FDX-B module sending text lines over UART
+#define RFID_FRONTEND RFID_FRONTEND_WIEGAND_ISR
+
+// Wiegand capture backend, follows the front end
+#define WIEGAND_CAPTURE_ISR 0        // One GPIO interrupt per bit
+#define WIEGAND_CAPTURE_RMT 1        // RMT peripheral records whole pulse trains (wiegand_rmt.cpp)
+#if RFID_FRONTEND == RFID_FRONTEND_WIEGAND_RMT
+#define WIEGAND_CAPTURE_MODE WIEGAND_CAPTURE_RMT
+#else
+#define WIEGAND_CAPTURE_MODE WIEGAND_CAPTURE_ISR
+#endif
+
+// Function declarations
+void debugPrint(const char* message);
+void debugPrintHex(const char* prefix, byte value);
+
+#endif //STATE_H
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "step_generator.h"
+
+StepGenerator::StepGenerator(const CoilDriver& coils)
+    : coils(coils), timer(NULL), maxSpeed(1), acceleration(1), rampShape(RAMP_TRAPEZOID), rampDirty(true),
+      position(0), direction(1), running(false) {
+    portMUX_INITIALIZE(&lock);
+}
+
+bool StepGenerator::begin() {
+    coils.begin();
+
+    gptimer_config_t timerConfig = {};
+    timerConfig.clk_src = GPTIMER_CLK_SRC_DEFAULT;
+    timerConfig.direction = GPTIMER_COUNT_UP;
+    timerConfig.resolution_hz = STEP_TIMER_HZ;
+    if (gptimer_new_timer(&timerConfig, &timer) != ESP_OK) {
+        timer = NULL;
+        return false;
+    }
+
+    gptimer_event_callbacks_t callbacks = {};
+    callbacks.on_alarm = &StepGenerator::onAlarm;
+    if (gptimer_register_event_callbacks(timer, &callbacks, this) != ESP_OK ||
+        gptimer_enable(timer) != ESP_OK) {
+        return false;
+    }
+    // Free running, a move only sets the alarm of its first step
+    return gptimer_start(timer) == ESP_OK;
+}
+
+void StepGenerator::setMaxSpeed(float stepsPerSecond) {
+    if (stepsPerSecond > 0 && stepsPerSecond != maxSpeed) {
+        maxSpeed = stepsPerSecond;
+        rampDirty = true;
+    }
+}
+
+void StepGenerator::setAcceleration(float stepsPerSecondSquared) {
+    if (stepsPerSecondSquared > 0 && stepsPerSecondSquared != acceleration) {
+        acceleration = stepsPerSecondSquared;
+        rampDirty = true;
+    }
+}
+
+void StepGenerator::setRampShape(RampShape shape) {
+    if (shape != rampShape) {
+        rampShape = shape;
+        rampDirty = true;
+    }
+}
+
+bool StepGenerator::move(long relative) {
+    if (timer == NULL || running) {
+        return false;
+    }
+    if (relative == 0) {
+        return true;
+    }
+    if (rampDirty) {
+        ramp.configure(maxSpeed, acceleration, rampShape, STEP_TIMER_HZ);
+        rampDirty = false;
+    }
+
+    portENTER_CRITICAL(&lock);
+    direction = relative > 0 ? 1 : -1;
+    ramp.start(relative > 0 ? relative : -relative);
+    running = true;
+    portEXIT_CRITICAL(&lock);
+
+    uint64_t now = 0;
+    gptimer_get_raw_count(timer, &now);
+    gptimer_alarm_config_t alarm = {};
+    alarm.alarm_count = now + STEP_START_DELAY_US;
+    return gptimer_set_alarm_action(timer, &alarm) == ESP_OK;
+}
+
+bool StepGenerator::moveTo(long absolute) {
+    return move(absolute - position);
+}
+
+void StepGenerator::stop() {
+    portENTER_CRITICAL(&lock);
+    ramp.stop();
+    portEXIT_CRITICAL(&lock);
+}
+
+long StepGenerator::distanceToGo() const {
+    portENTER_CRITICAL(&lock);
+    long distance = (long)ramp.stepsRemaining() * direction;
+    portEXIT_CRITICAL(&lock);
+    return distance;
+}
+
+long StepGenerator::targetPosition() const {
+    portENTER_CRITICAL(&lock);
+    long target = position + (long)ramp.stepsRemaining() * direction;
+    portEXIT_CRITICAL(&lock);
+    return target;
+}
+
+void StepGenerator::setCurrentPosition(long newPosition) {
+    if (!running) {
+        position = newPosition;
+    }
+}
+
+bool IRAM_ATTR StepGenerator::onAlarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t* edata, void* arg) {
+    return static_cast<StepGenerator*>(arg)->onStep(edata);
+}
+
+// One step per alarm, then the alarm of the next step
+bool IRAM_ATTR StepGenerator::onStep(const gptimer_alarm_event_data_t* edata) {
+    portENTER_CRITICAL_ISR(&lock);
+    if (ramp.isDone()) {
+        // Stopped before the first step
+        running = false;
+        portEXIT_CRITICAL_ISR(&lock);
+        return false;
+    }
+
+    long step = position + direction;
+    position = step;
+    uint32_t interval = ramp.next();
+    if (interval == 0) {
+        running = false;
+    }
+    portEXIT_CRITICAL_ISR(&lock);
+
+    coils.write(step & (COIL_PHASE_COUNT - 1));
+
+    if (interval > 0) {
+        // Counted from this alarm, not from now, so ISR latency doesn't add up.
+        // An alarm already in the past fires straight away.
+        gptimer_alarm_config_t alarm = {};
+        alarm.alarm_count = edata->alarm_value + interval;
+        gptimer_set_alarm_action(timer, &alarm);
+    }
+    return false;
+}
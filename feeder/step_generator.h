@@ -0,0 +1,64 @@
+#ifndef STEP_GENERATOR_H
+#define STEP_GENERATOR_H
+
+#include <Arduino.h>
+#include <driver/gptimer.h>
+#include "step_ramp.h"
+#include "coil_output.h"
+
+#define STEP_TIMER_HZ 1000000      // Step timer resolution, 1us
+#define STEP_START_DELAY_US 50     // From move() to the first step
+
+// Step generation for a 4-wire (two coil, full step) stepper from a hardware
+// timer interrupt, the coil sequence of AccelStepper::FULL4WIRE (written by a
+// CoilDriver, coil_output.h) but without
+// polling run(). The alarm ISR takes a step, gets the next interval from the
+// integer ramp (step_ramp.h) and reprograms the alarm, nothing else.
+// move()/moveTo() start a move and return immediately, stop() decelerates.
+class StepGenerator {
+private:
+    const CoilDriver coils;
+    gptimer_handle_t timer;
+    mutable portMUX_TYPE lock;              // Shared with the alarm ISR
+
+    // Ramp settings, applied at the start of the next move
+    float maxSpeed;                         // steps/s
+    float acceleration;                     // steps/s^2
+    RampShape rampShape;
+    bool rampDirty;
+
+    // Move in progress, owned by the ISR while running
+    StepRamp ramp;
+    volatile long position;
+    volatile int8_t direction;
+    volatile bool running;
+
+    bool IRAM_ATTR onStep(const gptimer_alarm_event_data_t* edata);
+    static bool IRAM_ATTR onAlarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t* edata, void* arg);
+
+public:
+    StepGenerator(const CoilDriver& coils);
+
+    // Configure the coil pins and the step timer
+    bool begin();
+
+    // Take effect at the start of the next move
+    void setMaxSpeed(float stepsPerSecond);
+    void setAcceleration(float stepsPerSecondSquared);
+    void setRampShape(RampShape shape);
+
+    // Start a move relative to / to an absolute position. Returns false while a move is running.
+    bool move(long relative);
+    bool moveTo(long absolute);
+
+    // Decelerate to a stop as soon as possible
+    void stop();
+
+    bool isRunning() const { return running; }
+    long distanceToGo() const;
+    long currentPosition() const { return position; }
+    long targetPosition() const;
+    void setCurrentPosition(long newPosition);   // While stopped
+};
+
+#endif //STEP_GENERATOR_H
@@ -0,0 +1,20 @@
+#include "step_ramp.h"
+#include <math.h>
+
+void StepRamp::configure(float maxSpeed, float acceleration, RampShape rampShape, uint32_t tickHz) {
+    if (maxSpeed < STEP_RAMP_MIN_SPEED) maxSpeed = STEP_RAMP_MIN_SPEED;
+    if (acceleration < 1) acceleration = 1;
+    shape = rampShape;
+
+    // 0.676 corrects the recurrence's error on the first step (Austin)
+    firstInterval = (uint32_t)(0.676 * tickHz * sqrt(2.0 / acceleration) * 256);
+    cruiseInterval = (uint32_t)(256.0 * tickHz / maxSpeed);
+    cruiseTicks = cruiseInterval >> 8;
+    if (cruiseTicks > 65535) cruiseTicks = 65535;
+
+    // The cubic ease peaks at 1.5 times the average acceleration, so the
+    // S-curve takes T = 1.5 * maxSpeed / acceleration and covers maxSpeed * T / 2
+    sCurveSteps = (uint32_t)(0.75 * maxSpeed * maxSpeed / acceleration);
+    if (sCurveSteps < 1) sCurveSteps = 1;
+    sCurveScale = (uint32_t)(((uint64_t)EASING_ONE << 8) / sCurveSteps);
+}
@@ -0,0 +1,161 @@
+#ifndef STEP_RAMP_H
+#define STEP_RAMP_H
+
+#include <stdint.h>
+#include "easing_table.h"
+
+#define STEP_RAMP_MIN_SPEED 16   // steps/s, slowest cruise speed (keeps the S-curve division in 32 bits)
+
+enum RampShape {
+    RAMP_TRAPEZOID,   // Constant acceleration
+    RAMP_S_CURVE      // Acceleration eases in and out, peaking at the configured value
+};
+
+// S-curve: speed follows the cubic ease over time, V(s) = 3s^2 - 2s^3 for
+// s = t / T, covering X(s) = 2s^3 - s^4 of the ramp distance. The step
+// generator knows where it is, not when, so the table holds V by position X.
+constexpr double sCurveDistance(double s) {
+    return s * s * s * (2 - s);
+}
+
+constexpr double sCurveTimeAt(double x, double low, double high, int iterations) {
+    return iterations == 0 ? (low + high) / 2
+         : sCurveDistance((low + high) / 2) < x ? sCurveTimeAt(x, (low + high) / 2, high, iterations - 1)
+                                                : sCurveTimeAt(x, low, (low + high) / 2, iterations - 1);
+}
+
+// Q16 share of the cruise speed at ramp position i / EASING_SEGMENTS
+constexpr uint16_t sCurveEntry(int i) {
+    return (uint16_t)(easeCubic(sCurveTimeAt((double)i / EASING_SEGMENTS, 0, 1, 40)) * 65535 + 0.5);
+}
+
+template <typename Indices>
+struct SCurveTables;
+
+template <int... I>
+struct SCurveTables<EasingIndices<I...> > {
+    static constexpr uint16_t speed[EASING_SEGMENTS + 1] = { sCurveEntry(I)... };
+};
+
+template <int... I>
+constexpr uint16_t SCurveTables<EasingIndices<I...> >::speed[EASING_SEGMENTS + 1];
+
+typedef SCurveTables<MakeEasingIndices<EASING_SEGMENTS + 1>::type> SCurve;
+
+static_assert(SCurve::speed[0] == 0 && SCurve::speed[EASING_SEGMENTS] == 65535,
+              "The S-curve starts at standstill and ends at cruise speed");
+
+// Step intervals of one move, computed a step at a time with integers only.
+// The trapezoid uses the Austin/Eiderman recurrence
+//     c(k) = c(k-1) - 2 c(k-1) / (4k + 1)
+// for the interval at ramp position k, run backwards to decelerate; the
+// S-curve looks the speed at k up in a compile-time table. Either way the
+// interval depends only on the ramp position, so decelerating walks the
+// accelerating intervals in reverse and stopping early just shortens the move.
+// configure() does the only floating point, once per speed change.
+class StepRamp {
+private:
+    RampShape shape;
+    uint32_t firstInterval;    // Ticks from standstill to the second step, Q8
+    uint32_t cruiseInterval;   // Ticks at the cruise speed, Q8
+    uint32_t cruiseTicks;      // The same in whole ticks, below 65536
+    uint32_t sCurveSteps;      // S-curve ramp length
+    uint32_t sCurveScale;      // Q16 ramp progress per step, Q8
+
+    // Move in progress
+    uint32_t remaining;        // Steps still to take
+    uint32_t rampIndex;        // Position on the ramp, k
+    uint32_t interval;         // Trapezoid: the interval that reached rampIndex, Q8
+
+    uint32_t sCurveInterval(uint32_t k) const {
+        uint32_t progress = (uint32_t)(((uint64_t)k * sCurveScale) >> 8);
+        uint32_t speed = easeTableValue(progress);
+        if (speed == 0) {
+            return firstInterval >> 8;
+        }
+        uint32_t ticks = (cruiseTicks << 16) / speed;
+        return ticks < (firstInterval >> 8) ? ticks : firstInterval >> 8;
+    }
+
+    static uint32_t easeTableValue(uint32_t t) {
+        if (t >= EASING_ONE) {
+            return 65535;
+        }
+        uint32_t segment = t >> EASING_FRACTION_BITS;
+        int32_t fraction = t & ((1 << EASING_FRACTION_BITS) - 1);
+        int32_t from = SCurve::speed[segment];
+        int32_t to = SCurve::speed[segment + 1];
+        return (uint32_t)(from + (((to - from) * fraction) >> EASING_FRACTION_BITS));
+    }
+
+public:
+    StepRamp() : shape(RAMP_TRAPEZOID), firstInterval(0), cruiseInterval(0), cruiseTicks(0), sCurveSteps(0),
+                 sCurveScale(0), remaining(0), rampIndex(0), interval(0) {}
+
+    // Speeds in steps/s and steps/s^2, intervals in ticks of a tickHz timer.
+    // Only while no move is running.
+    void configure(float maxSpeed, float acceleration, RampShape shape, uint32_t tickHz);
+
+    // Start a move of steps from standstill
+    void start(uint32_t steps) {
+        remaining = steps;
+        rampIndex = 0;
+        interval = 0;
+    }
+
+    // Decelerate now, taking only as many steps as the ramp down needs
+    void stop() {
+        if (remaining > rampIndex) {
+            remaining = rampIndex;
+        }
+    }
+
+    // Account for one step taken and return the ticks until the next one,
+    // 0 once the move is complete
+    inline uint32_t next() {
+        if (remaining > 0) {
+            remaining--;
+        }
+        if (remaining == 0) {
+            return 0;
+        }
+
+        if (shape == RAMP_S_CURVE) {
+            if (remaining <= rampIndex) {
+                rampIndex--;
+                return sCurveInterval(rampIndex);
+            }
+            if (rampIndex < sCurveSteps) {
+                return sCurveInterval(rampIndex++);
+            }
+            return cruiseTicks;
+        }
+
+        if (remaining <= rampIndex) {
+            // Decelerate: repeat the interval that reached this speed, then
+            // step the recurrence back, c(k-1) = c(k) + 2 c(k) / (4k - 1)
+            uint32_t ticks = interval;
+            rampIndex--;
+            if (rampIndex > 0) {
+                interval += (2 * interval) / (4 * rampIndex - 1);
+            }
+            return ticks >> 8;
+        }
+
+        uint32_t nextInterval = rampIndex == 0 ? firstInterval
+                                               : interval - (2 * interval) / (4 * rampIndex + 1);
+        if (nextInterval < cruiseInterval) {
+            // At cruise speed, the ramp position stays where deceleration starts from
+            return cruiseInterval >> 8;
+        }
+        interval = nextInterval;
+        rampIndex++;
+        return nextInterval >> 8;
+    }
+
+    bool isDone() const { return remaining == 0; }
+    uint32_t stepsRemaining() const { return remaining; }
+    uint32_t rampPosition() const { return rampIndex; }
+};
+
+#endif //STEP_RAMP_H
@@ -7,9 +7,13 @@
 unsigned long lastTimeCheck = 0;
 const unsigned long TIME_CHECK_INTERVAL = 10000; // Check time every 10 seconds
 
-// Stepper motor control with AccelStepper
-// Define a stepper motor controlled by 4 digital pins (4-wire stepper)
-AccelStepper stepper(AccelStepper::FULL4WIRE, STEPPER_PIN1, STEPPER_PIN4, STEPPER_PIN2, STEPPER_PIN3);
+// Stepper motor controlled by 4 digital pins (4-wire stepper), stepped from a hardware timer.
+// Coils written through the GPIO registers, same pin order as the AccelStepper::FULL4WIRE stepper it replaces.
+typedef CoilOutput<STEPPER_GPIO1, STEPPER_GPIO4, STEPPER_GPIO2, STEPPER_GPIO3> StepperCoils;
+StepGenerator stepper(StepperCoils::driver);
+
+// Forward/backward feeding cycle, advanced by updateStepperRotation()
+DispenseCycle dispenser(stepper, FORWARD_STEPS, BACKWARD_STEPS, FEED_DIRECTION);
 
 const char *ntpServer = "pool.ntp.org";
 const long gmtOffset_sec = -21600; // -6 hours for CST
@@ -135,87 +139,47 @@ void scheduleStepperRotation(const char *taskName) {
     debugPrint(message);
 }
 
-void startStepperRotation() {
-    String timeStr = getTimeString();
-    debugPrint(("Starting stepper motor rotation at " + timeStr).c_str());
-    performSafeModeRotation(STEPS_PER_REVOLUTION, false); // Move 200 steps (one full revolution)
-}
-
-void safeRotate(int &currentSteps, int totalSteps) {
-    // Calculate steps for the forward and backward motion
-    const int FORWARD_STEPS = 200;
-    const int BACKWARD_STEPS = 50;
-    const int NET_STEPS_PER_CYCLE = FORWARD_STEPS - BACKWARD_STEPS; // 2400 net steps
-
-    // Set the speed for the safe mode operation
-    // You can adjust this value to match your original delay timing
-    stepper.setMaxSpeed(500); // Adjust based on your needs
-    stepper.setAcceleration(200); // Slower acceleration for safe mode
-
-    debugPrint("Safe mode: Moving forward...");
-    // The drill spiral rotates opposite of what traditional forward is so without
-    // reversing it food will get pulled inward
-    stepper.move(-FORWARD_STEPS);
-
-    // Run the stepper until it completes the forward movement
-    while (stepper.distanceToGo() != 0) {
-        stepper.run();
-    }
+// Start an anti-jam dispense of netSteps, 0 to run until cancelled
+static void beginDispense(long netSteps) {
+    debugPrint("Starting safe mode rotation to avoid jams");
 
-    debugPrint("Safe mode: Moving backward...");
-    stepper.move(BACKWARD_STEPS);
+    // Enable the stepper motor
+    enableStepperMotor();
 
-    // Run the stepper until it completes the backward movement
-    while (stepper.distanceToGo() != 0) {
-        stepper.run();
+    stepper.setMaxSpeed(DISPENSE_MAX_SPEED);
+    stepper.setAcceleration(DISPENSE_ACCELERATION);
+    stepper.setRampShape(DISPENSE_RAMP);
+    stepperRotating = dispenser.start(netSteps);
+    if (!stepperRotating) {
+        disableStepperMotor();
     }
-
-    // Update the current step count with the net movement
-    currentSteps += NET_STEPS_PER_CYCLE;
-
-    // Debug output
-    char message[100];
-    sprintf(message, "Safe mode progress: %d/%d steps", currentSteps, totalSteps);
-    debugPrint(message);
 }
 
-void performSafeModeRotation(int totalSteps, boolean allowInterrupt) {
-    debugPrint("Starting safe mode rotation to avoid jams");
-
-    // Enable the stepper motor
-    enableStepperMotor();
+void startStepperRotation() {
+    String timeStr = getTimeString();
+    debugPrint(("Starting stepper motor rotation at " + timeStr).c_str());
+    beginDispense(STEPS_PER_REVOLUTION);
+}
 
-    int currentSteps = 0;
-    if (buttonControlActive && allowInterrupt) {
-        debugPrint("Button activated and interrupt allowed");
-        // call safe rotate indefinitely until button released
-        while (buttonControlActive) {
-            checkStepperButton();
-            debugPrint("buttonControlActive: ");
-            Serial.println(buttonControlActive);
-            safeRotate(currentSteps, totalSteps);
-        }
-    } else {
-        while (currentSteps < totalSteps) {
-            safeRotate(currentSteps, totalSteps);
-        }
+// Advance the dispense, call every loop. The motor runs on its own, this only
+// sequences the forward/backward phases and reports progress.
+void updateStepperRotation() {
+    uint32_t cyclesBefore = dispenser.cycles();
+    boolean finished = dispenser.tick();
 
-        // If we've overshot the target, correct the position
-        // if (currentSteps > totalSteps) {
-        //     int overshoot = currentSteps - totalSteps;
-        //     debugPrint("Correcting overshoot...");
-        //     stepper.move(-overshoot);
-        //
-        //     while (stepper.distanceToGo() != 0) {
-        //         stepper.run();
-        //     }
-        // }
+    if (dispenser.cycles() != cyclesBefore) {
+        char message[100];
+        sprintf(message, "Safe mode progress: %ld/%ld steps", dispenser.dispensedSteps(), dispenser.target());
+        debugPrint(message);
     }
 
-    stepperRotating = false;
+    if (finished) {
+        stepperRotating = false;
+        buttonControlActive = false;
 
-    disableStepperMotor();
-    debugPrint("Safe mode rotation complete");
+        disableStepperMotor();
+        debugPrint("Safe mode rotation complete");
+    }
 }
 
 void enableStepperMotor() {
@@ -249,13 +213,16 @@ void checkStepperButton() {
 
             // Button is pressed (LOW when using INPUT_PULLUP)
             if (stepperButtonPressed == LOW) {
-                debugPrint("Button pressed - starting continuous stepper rotation");
-                buttonControlActive = true;
-            } else {
+                // A scheduled feeding already running keeps going
+                if (!stepperRotating) {
+                    debugPrint("Button pressed - starting continuous stepper rotation");
+                    buttonControlActive = true;
+                    beginDispense(0);
+                }
+            } else if (buttonControlActive) {
+                // Decelerates, updateStepperRotation() disables the motor once it stopped
                 debugPrint("Button released - stopping stepper rotation");
-                stepper.stop(); // Stop the stepper
-                buttonControlActive = false;
-                disableStepperMotor();
+                dispenser.cancel();
             }
         }
     }
@@ -2,8 +2,8 @@
 #define STEPPER_CONTROL_H
 
 #include <Arduino.h>
-#include <ESP32Servo.h>      // Include ESP32Servo library instead of Servo.h
-#include <AccelStepper.h>    // Include the AccelStepper library
+#include "step_generator.h" // Timer driven step pulses
+#include "dispense_cycle.h"
 
 #define DEBUG 1              // Set to 1 to enable debug messages, 0 to disable
 #define DATA0_PIN 0          // Data0 pin (RX0 on D0)
@@ -21,6 +21,14 @@
 #define STEPPER_ENA 6        // ENA pin for L298N driver
 #define STEPPER_ENB 7        // ENB pin for L298N driver
 
+// Anti-jam dispensing (dispense_cycle.h)
+#define FORWARD_STEPS 200       // Auger turn that pushes food out
+#define BACKWARD_STEPS 50       // Turn back after each forward turn, clears jams
+#define FEED_DIRECTION -1       // The drill spiral pulls food inward when turned the traditional forward way
+#define DISPENSE_MAX_SPEED 500  // steps/s
+#define DISPENSE_ACCELERATION 200 // steps/s^2, slow for the anti-jam cycle
+#define DISPENSE_RAMP RAMP_TRAPEZOID // Or RAMP_S_CURVE for gentler starts, at the same peak acceleration
+
 // Cron-like scheduler structure
 #define MAX_SCHEDULED_TASKS 10  // Maximum number of scheduled tasks
 typedef struct {
@@ -40,7 +48,8 @@ extern unsigned long lastTimeCheck;
 extern const unsigned long TIME_CHECK_INTERVAL;
 
 // Stepper control
-extern AccelStepper stepper;
+extern StepGenerator stepper;
+extern DispenseCycle dispenser;
 
 // WiFi and time configuration
 extern const char* ntpServer;
@@ -73,6 +82,6 @@ void startStepperRotation();
 void checkStepperButton();
 void enableStepperMotor();
 void disableStepperMotor();
-void performSafeModeRotation(int totalSteps, boolean allowInterrupt);
+void updateStepperRotation();
 
 #endif //STEPPER_CONTROL_H
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifndef TAG_READ_H
+#define TAG_READ_H
+
+#include <Arduino.h>
+
+#define MAX_RFID_READERS 4   // Readers (one per bowl antenna) one controller can poll
+
+// One frame or line a reader has finished receiving
+typedef struct {
+    uint8_t reader;          // Index of the reader that received it, selects the bowl
+    bool valid;              // Decoded to a tag ID, otherwise noise or a damaged read
+    uint64_t tagId;          // Decoded card / animal ID, 0 if not valid
+} TagRead;
+
+#endif //TAG_READ_H
@@ -0,0 +1,112 @@
+#include "tag_table.h"
+
+TagTable tagTable;
+
+static constexpr int log2Of(uint32_t n) {
+    return n <= 1 ? 0 : 1 + log2Of(n >> 1);
+}
+
+static_assert(TAG_TABLE_SLOTS >= 2 && (TAG_TABLE_SLOTS & (TAG_TABLE_SLOTS - 1)) == 0,
+              "TAG_TABLE_SLOTS must be a power of two");
+static_assert(TAG_TABLE_SLOTS >= 2 * MAX_PETS, "TAG_TABLE_SLOTS must be at least twice MAX_PETS");
+
+#define TAG_TABLE_SLOT_SHIFT (64 - log2Of(TAG_TABLE_SLOTS))  // Keeps log2(TAG_TABLE_SLOTS) bits of the hash
+
+TagTable::TagTable() : count(0) {
+    memset(slots, -1, sizeof(slots));
+}
+
+// Fibonacci hashing: multiply by 2^64/phi and keep the top bits
+uint16_t TagTable::slotFor(uint64_t tagId) {
+    return (uint16_t)((tagId * 0x9E3779B97F4A7C15ULL) >> TAG_TABLE_SLOT_SHIFT);
+}
+
+void TagTable::rebuildIndex() {
+    memset(slots, -1, sizeof(slots));
+    for (int i = 0; i < count; i++) {
+        uint16_t slot = slotFor(entries[i].tagId);
+        while (slots[slot] >= 0) {
+            slot = (slot + 1) & (TAG_TABLE_SLOTS - 1);
+        }
+        slots[slot] = i;
+    }
+}
+
+// Load the table from persistent storage
+bool TagTable::begin() {
+    preferences.begin("tagTable", false); // "tagTable" is the namespace
+
+    size_t length = preferences.getBytesLength("pets");
+    if (length == 0 || length % sizeof(PetEntry) != 0 || length > sizeof(entries)) {
+        Serial.println("No saved pets found in persistent storage");
+        count = 0;
+        rebuildIndex();
+        return false;
+    }
+
+    preferences.getBytes("pets", entries, length);
+    count = length / sizeof(PetEntry);
+    rebuildIndex();
+
+    Serial.print("Loaded ");
+    Serial.print(count);
+    Serial.println(" pets from persistent storage");
+    return true;
+}
+
+// Constant-time lookup, the table is never more than half full
+const PetEntry* TagTable::lookup(uint64_t tagId) const {
+    uint16_t slot = slotFor(tagId);
+    while (slots[slot] >= 0) {
+        const PetEntry& candidate = entries[slots[slot]];
+        if (candidate.tagId == tagId) {
+            return &candidate;
+        }
+        slot = (slot + 1) & (TAG_TABLE_SLOTS - 1);
+    }
+    return NULL;
+}
+
+bool TagTable::isAllowed(uint64_t tagId, uint8_t bowl) const {
+    if (count == 0) {
+        return TAG_TABLE_OPEN_WHEN_EMPTY;
+    }
+    const PetEntry* pet = lookup(tagId);
+    return pet != NULL && (pet->bowls & (1 << bowl));
+}
+
+// Replace the whole table and save it to persistent storage
+bool TagTable::replaceAll(const PetEntry* newEntries, int newCount) {
+    if (newCount < 0 || newCount > MAX_PETS) {
+        Serial.println("Too many pets!");
+        return false;
+    }
+
+    // Keep the stored array sorted by tag ID (insertion sort, the table is small)
+    PetEntry sorted[MAX_PETS];
+    for (int i = 0; i < newCount; i++) {
+        PetEntry entry = newEntries[i];
+        entry.name[PET_NAME_LEN - 1] = 0;
+        int j = i - 1;
+        while (j >= 0 && sorted[j].tagId > entry.tagId) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        if (j >= 0 && sorted[j].tagId == entry.tagId) {
+            Serial.println("Duplicate tag ID in pet list!");
+            return false;
+        }
+        sorted[j + 1] = entry;
+    }
+
+    memcpy(entries, sorted, newCount * sizeof(PetEntry));
+    count = newCount;
+    rebuildIndex();
+
+    // Clear previous data
+    preferences.remove("pets");
+    if (count == 0) {
+        return true;
+    }
+    return preferences.putBytes("pets", entries, count * sizeof(PetEntry)) == count * sizeof(PetEntry);
+}
@@ -0,0 +1,47 @@
+#ifndef TAG_TABLE_H
+#define TAG_TABLE_H
+
+#include <Arduino.h>
+#include <Preferences.h>  // For persistent storage
+
+#define MAX_PETS 32                 // Maximum number of authorized tags
+#define PET_NAME_LEN 16             // Including the terminator
+#define TAG_TABLE_SLOTS 64          // Hash slots, power of two and at least twice MAX_PETS
+#define TAG_TABLE_OPEN_WHEN_EMPTY 1 // With no pets configured any valid tag opens the lid
+
+// Permission bits: bit n set means the pet may eat from the bowl served by reader n
+#define PET_ALL_BOWLS 0xFF
+
+typedef struct {
+    uint64_t tagId;             // Decoded card / animal ID
+    char name[PET_NAME_LEN];    // Pet name for logs and the web UI
+    uint8_t bowls;              // Bowls this pet may eat from (bitmask by reader index)
+} PetEntry;
+
+// Allowlist of pet tags. Stored in NVS as a compact array sorted by tag ID,
+// looked up in RAM through an open-addressing hash index.
+class TagTable {
+private:
+    PetEntry entries[MAX_PETS];
+    int count;
+    int8_t slots[TAG_TABLE_SLOTS];  // Index into entries, -1 for an empty slot
+    Preferences preferences;
+
+    static uint16_t slotFor(uint64_t tagId);
+    void rebuildIndex();
+
+public:
+    TagTable();
+
+    bool begin();
+    const PetEntry* lookup(uint64_t tagId) const;
+    bool isAllowed(uint64_t tagId, uint8_t bowl) const;
+    bool replaceAll(const PetEntry* newEntries, int newCount);
+
+    int size() const { return count; }
+    const PetEntry& entry(int i) const { return entries[i]; }
+};
+
+extern TagTable tagTable;
+
+#endif //TAG_TABLE_H
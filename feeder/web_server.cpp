@@ -0,0 +1,579 @@
+#include "web_server.h"
+#include "html_content.h" // Include the HTML content header file
+#include "rfid_control.h" // For the read statistics and the lid servo
+#include <errno.h>
+
+TaskSchedulerWebServer::TaskSchedulerWebServer(const char* wifi_ssid, const char* wifi_password, int port)
+    : server(port), ssid(wifi_ssid), password(wifi_password), serverStarted(false) {
+}
+
+// Save tasks to persistent storage
+bool TaskSchedulerWebServer::saveTasks() {
+    String tasksJson = tasksToJson();
+
+    // Clear previous data
+    preferences.remove("tasks");
+
+    // Save the JSON string to preferences
+    return preferences.putString("tasks", tasksJson);
+}
+
+// Load tasks from persistent storage
+bool TaskSchedulerWebServer::loadTasks() {
+    // Check if tasks exist in preferences
+    if (!preferences.isKey("tasks")) {
+        Serial.println("No saved tasks found in persistent storage");
+        return false;
+    }
+
+    // Get the JSON string
+    // TODO: don't use JSON, it's easy but wasteful
+    String tasksJson = preferences.getString("tasks", "[]");
+    Serial.println("Loaded tasks from persistent storage:");
+    Serial.println(tasksJson);
+
+    // Parse JSON
+    DynamicJsonDocument doc(2048); // Adjust size based on expected payload
+    DeserializationError error = deserializeJson(doc, tasksJson);
+
+    if (error) {
+        Serial.print("Failed to parse JSON from persistent storage: ");
+        Serial.println(error.c_str());
+        return false;
+    }
+
+    // Process the JSON data
+    JsonArray tasksArray = doc.as<JsonArray>();
+
+    return updateScheduledTasks(tasksArray);
+}
+
+TaskSchedulerWebServer::~TaskSchedulerWebServer() {
+    if (serverStarted) {
+        server.stop();
+    }
+    // Close the preferences namespace
+    preferences.end();
+}
+
+bool TaskSchedulerWebServer::begin() {
+    // Connect to WiFi
+    WiFi.begin(ssid, password);
+
+    // Wait for connection, with timeout
+    unsigned long startTime = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - startTime < 20000) {
+        delay(500);
+        Serial.print(".");
+    }
+
+    if (WiFi.status() != WL_CONNECTED) {
+        Serial.println("\nFailed to connect to WiFi");
+        return false;
+    }
+
+    localIP = WiFi.localIP();
+    Serial.println("");
+    Serial.print("Connected to WiFi with IP address: ");
+    Serial.println(localIP);
+
+    // Initialize preferences for persistent storage
+    preferences.begin("taskSched", false); // "taskSched" is the namespace
+
+    // Load saved tasks from persistent storage
+    loadTasks();
+
+    // Set up the server routes
+    server.on("/", HTTP_GET, [this](){ this->handleRoot(); });
+    server.on("/get-tasks", HTTP_GET, [this](){ this->handleGetTasks(); });
+    server.on("/save-tasks", HTTP_POST, [this](){ this->handleSaveTasks(); });
+    server.on("/get-pets", HTTP_GET, [this](){ this->handleGetPets(); });
+    server.on("/save-pets", HTTP_POST, [this](){ this->handleSavePets(); });
+    server.on("/start-capture", HTTP_POST, [this](){ this->handleStartCapture(); });
+    server.on("/stop-capture", HTTP_POST, [this](){ this->handleStopCapture(); });
+    server.on("/get-capture", HTTP_GET, [this](){ this->handleGetCapture(); });
+    server.on("/get-stats", HTTP_GET, [this](){ this->handleGetStats(); });
+    server.on("/reset-stats", HTTP_POST, [this](){ this->handleResetStats(); });
+    server.on("/dispense", HTTP_POST, [this](){ this->handleDispense(); });
+    server.onNotFound([this](){ this->handleNotFound(); });
+
+    // Start server
+    server.begin();
+    serverStarted = true;
+    Serial.println("HTTP server started");
+
+    return true;
+}
+
+void TaskSchedulerWebServer::handleClient() {
+    if (serverStarted) {
+        server.handleClient();
+    }
+}
+
+IPAddress TaskSchedulerWebServer::getIP() const {
+    return localIP;
+}
+
+bool TaskSchedulerWebServer::isRunning() const {
+    return serverStarted;
+}
+
+void TaskSchedulerWebServer::handleRoot() {
+    server.send(200, "text/html", INDEX_HTML); // INDEX_HTML is now from html_content.h
+}
+
+void TaskSchedulerWebServer::handleGetTasks() {
+    String tasksJson = tasksToJson();
+    server.send(200, "application/json", tasksJson);
+}
+
+void TaskSchedulerWebServer::handleSaveTasks() {
+    if (!server.hasArg("plain")) {
+        server.send(400, "text/plain", "No data received");
+        return;
+    }
+
+    String jsonString = server.arg("plain");
+
+    // Parse JSON
+    DynamicJsonDocument doc(2048); // Adjust size based on expected payload
+    DeserializationError error = deserializeJson(doc, jsonString);
+
+    if (error) {
+        String errorMsg = "Failed to parse JSON: ";
+        errorMsg += error.c_str();
+        server.send(400, "text/plain", errorMsg);
+        return;
+    }
+
+    // Process the JSON data
+    JsonArray tasksArray = doc.as<JsonArray>();
+
+    if (updateScheduledTasks(tasksArray)) {
+        // Save the tasks to persistent storage
+        if (saveTasks()) {
+            server.send(200, "text/plain", "Tasks updated and saved successfully");
+        } else {
+            server.send(200, "text/plain", "Tasks updated but failed to save to persistent storage");
+        }
+    } else {
+        server.send(500, "text/plain", "Failed to update tasks");
+    }
+}
+
+void TaskSchedulerWebServer::handleGetPets() {
+    String petsJson = petsToJson();
+    server.send(200, "application/json", petsJson);
+}
+
+void TaskSchedulerWebServer::handleSavePets() {
+    if (!server.hasArg("plain")) {
+        server.send(400, "text/plain", "No data received");
+        return;
+    }
+
+    String jsonString = server.arg("plain");
+
+    // Parse JSON
+    DynamicJsonDocument doc(4096); // Up to MAX_PETS entries
+    DeserializationError error = deserializeJson(doc, jsonString);
+
+    if (error) {
+        String errorMsg = "Failed to parse JSON: ";
+        errorMsg += error.c_str();
+        server.send(400, "text/plain", errorMsg);
+        return;
+    }
+
+    // Process the JSON data
+    JsonArray petsArray = doc.as<JsonArray>();
+
+    if (updatePets(petsArray)) {
+        server.send(200, "text/plain", "Pets updated successfully");
+    } else {
+        server.send(500, "text/plain", "Failed to update pets");
+    }
+}
+
+void TaskSchedulerWebServer::handleStartCapture() {
+    logicCapture.start();
+    server.send(200, "text/plain", "Capture started");
+}
+
+void TaskSchedulerWebServer::handleStopCapture() {
+    logicCapture.stop();
+    server.send(200, "text/plain", "Capture stopped");
+}
+
+// Download the capture, as VCD by default or ?format=bin for the binary format (logic_capture.h)
+void TaskSchedulerWebServer::handleGetCapture() {
+    if (server.arg("format") == "bin") {
+        sendCaptureBinary();
+    } else {
+        sendCaptureVcd();
+    }
+}
+
+void TaskSchedulerWebServer::handleGetStats() {
+    String statsJson = statsToJson();
+    server.send(200, "application/json", statsJson);
+}
+
+void TaskSchedulerWebServer::handleResetStats() {
+    rfidFrontEnd.resetStats();
+    server.send(200, "text/plain", "Statistics reset");
+}
+
+// Control a running dispense with ?action=pause, resume or cancel
+void TaskSchedulerWebServer::handleDispense() {
+    String action = server.arg("action");
+    if (!dispenser.isActive()) {
+        server.send(409, "text/plain", "No dispense running");
+    } else if (action == "pause") {
+        dispenser.pause();
+        server.send(200, "text/plain", "Dispense paused");
+    } else if (action == "resume") {
+        dispenser.resume();
+        server.send(200, "text/plain", "Dispense resumed");
+    } else if (action == "cancel") {
+        dispenser.cancel();
+        server.send(200, "text/plain", "Dispense cancelled");
+    } else {
+        server.send(400, "text/plain", "Unknown action");
+    }
+}
+
+void TaskSchedulerWebServer::handleNotFound() {
+    server.send(404, "text/plain", "Not found");
+}
+
+bool TaskSchedulerWebServer::updateScheduledTasks(const JsonArray& tasksArray) {
+    // Check if we have too many tasks
+    if (tasksArray.size() > MAX_SCHEDULED_TASKS - 1) { // Leave room for NULL terminator
+        Serial.println("Too many tasks!");
+        return false;
+    }
+
+    // Reset all tasks
+    for (int i = 0; i < MAX_SCHEDULED_TASKS; i++) {
+        scheduledTasks[i].minute = -1;
+        scheduledTasks[i].hour = -1;
+        scheduledTasks[i].dayOfMonth = -1;
+        scheduledTasks[i].month = -1;
+        scheduledTasks[i].dayOfWeek = -1;
+        scheduledTasks[i].lastRun = false;
+        scheduledTasks[i].name = NULL;
+    }
+
+    // Update tasks from the received JSON
+    int i = 0;
+    for (JsonVariant taskVar : tasksArray) {
+        JsonObject task = taskVar.as<JsonObject>();
+
+        // Create a new permanent storage for the name string
+        // We need to do this because the task.name in your structure is a pointer that needs
+        // to point to permanent storage, not temporary variables
+        char* taskName = (char*)malloc(50); // Allocate memory for task name
+        if (taskName == NULL) {
+            Serial.println("Memory allocation failed!");
+            return false;
+        }
+
+        // Copy the name from the JSON into the allocated memory
+        strlcpy(taskName, task["name"].as<const char*>(), 50);
+
+        // Update the scheduledTasks array
+        scheduledTasks[i].minute = task["minute"].as<int>();
+        scheduledTasks[i].hour = task["hour"].as<int>();
+        scheduledTasks[i].dayOfMonth = task["dayOfMonth"].as<int>();
+        scheduledTasks[i].month = task["month"].as<int>();
+        scheduledTasks[i].dayOfWeek = task["dayOfWeek"].as<int>();
+        scheduledTasks[i].lastRun = false;
+        scheduledTasks[i].name = taskName;
+
+        i++;
+    }
+
+    // Set the terminator
+    scheduledTasks[i].name = NULL;
+
+    Serial.print("Updated ");
+    Serial.print(i);
+    Serial.println(" tasks");
+
+    return true;
+}
+
+String TaskSchedulerWebServer::tasksToJson() {
+    DynamicJsonDocument doc(2048); // Adjust size based on expected payload
+    JsonArray tasksArray = doc.to<JsonArray>();
+
+    // Convert scheduledTasks to JSON
+    for (int i = 0; i < MAX_SCHEDULED_TASKS; i++) {
+        if (scheduledTasks[i].name == NULL) break;
+
+        JsonObject task = tasksArray.createNestedObject();
+        task["name"] = scheduledTasks[i].name;
+        task["minute"] = scheduledTasks[i].minute;
+        task["hour"] = scheduledTasks[i].hour;
+        task["dayOfMonth"] = scheduledTasks[i].dayOfMonth;
+        task["month"] = scheduledTasks[i].month;
+        task["dayOfWeek"] = scheduledTasks[i].dayOfWeek;
+    }
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    return jsonString;
+}
+
+// Tag IDs are sent as decimal strings, JavaScript numbers can't hold 64 bits
+bool TaskSchedulerWebServer::updatePets(const JsonArray& petsArray) {
+    if (petsArray.size() > MAX_PETS) {
+        Serial.println("Too many pets!");
+        return false;
+    }
+
+    PetEntry pets[MAX_PETS];
+    int i = 0;
+    for (JsonVariant petVar : petsArray) {
+        JsonObject pet = petVar.as<JsonObject>();
+
+        const char* tag = pet["tag"].as<const char*>();
+        if (tag == NULL) {
+            Serial.println("Pet without a tag ID!");
+            return false;
+        }
+
+        // Only plain decimal digits, strtoull() would also take a sign or
+        // whitespace, stop at the first stray character or saturate
+        char* end;
+        errno = 0;
+        unsigned long long tagId = strtoull(tag, &end, 10);
+        if (!isdigit((unsigned char)tag[0]) || *end != 0 || errno == ERANGE) {
+            Serial.print("Invalid tag ID: ");
+            Serial.println(tag);
+            return false;
+        }
+
+        memset(&pets[i], 0, sizeof(PetEntry));
+        pets[i].tagId = tagId;
+        const char* name = pet["name"].as<const char*>();
+        strlcpy(pets[i].name, name ? name : "", PET_NAME_LEN);
+        pets[i].bowls = pet.containsKey("bowls") ? pet["bowls"].as<int>() : PET_ALL_BOWLS;
+
+        i++;
+    }
+
+    if (!tagTable.replaceAll(pets, i)) {
+        return false;
+    }
+
+    Serial.print("Updated ");
+    Serial.print(i);
+    Serial.println(" pets");
+
+    return true;
+}
+
+String TaskSchedulerWebServer::petsToJson() {
+    DynamicJsonDocument doc(4096); // Up to MAX_PETS entries
+    JsonArray petsArray = doc.to<JsonArray>();
+
+    for (int i = 0; i < tagTable.size(); i++) {
+        const PetEntry& entry = tagTable.entry(i);
+        char tag[21];
+        snprintf(tag, sizeof(tag), "%llu", (unsigned long long)entry.tagId);
+
+        JsonObject pet = petsArray.createNestedObject();
+        pet["tag"] = tag; // Copied into the document
+        pet["name"] = (const char*)entry.name;
+        pet["bowls"] = entry.bowls;
+    }
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    return jsonString;
+}
+
+// VCD for GTKWave or PulseView. Edges are VCD events, received bytes 8-bit vectors.
+void TaskSchedulerWebServer::sendCaptureVcd() {
+    char chunk[512];
+    int length = 0;
+
+    server.sendHeader("Content-Disposition", "attachment; filename=capture.vcd");
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/plain", "");
+
+    length += snprintf(chunk + length, sizeof(chunk) - length, "$timescale 1us $end\n$scope module feeder $end\n");
+    for (uint8_t i = 0; i < logicCapture.channels(); i++) {
+        length += snprintf(chunk + length, sizeof(chunk) - length, "$var wire %d %c %s $end\n",
+                           logicCapture.width(), '!' + i, logicCapture.channelName(i));
+    }
+    length += snprintf(chunk + length, sizeof(chunk) - length, "$upscope $end\n$enddefinitions $end\n");
+    server.sendContent(chunk, length);
+    length = 0;
+
+    uint16_t count = logicCapture.size();
+    uint32_t firstUs = count > 0 ? logicCapture.sample(0).timeUs : 0;
+    uint32_t lastUs = 0;
+
+    for (uint16_t i = 0; i < count; i++) {
+        const CaptureSample& sample = logicCapture.sample(i);
+        uint32_t timeUs = sample.timeUs - firstUs;
+
+        if (i == 0 || timeUs != lastUs) {
+            length += snprintf(chunk + length, sizeof(chunk) - length, "#%lu\n", (unsigned long)timeUs);
+            lastUs = timeUs;
+        }
+
+        if (logicCapture.width() == 1) {
+            length += snprintf(chunk + length, sizeof(chunk) - length, "%c%c\n",
+                               sample.value ? '1' : '0', '!' + sample.channel);
+        } else {
+            chunk[length++] = 'b';
+            for (int bit = logicCapture.width() - 1; bit >= 0; bit--) {
+                chunk[length++] = (sample.value >> bit) & 1 ? '1' : '0';
+            }
+            length += snprintf(chunk + length, sizeof(chunk) - length, " %c\n", '!' + sample.channel);
+        }
+
+        // Leave room for the longest sample before sending
+        if (length > (int)sizeof(chunk) - 32) {
+            server.sendContent(chunk, length);
+            length = 0;
+        }
+    }
+
+    if (length > 0) {
+        server.sendContent(chunk, length);
+    }
+    server.sendContent("");
+}
+
+void TaskSchedulerWebServer::sendCaptureBinary() {
+    uint8_t chunk[512];
+    int length = 0;
+
+    server.sendHeader("Content-Disposition", "attachment; filename=capture.bin");
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/octet-stream", "");
+
+    uint16_t count = logicCapture.size();
+    uint32_t overwritten = logicCapture.overwritten();
+
+    memcpy(chunk, "LCAP", 4);
+    length = 4;
+    chunk[length++] = 2; // Version
+    chunk[length++] = logicCapture.channels();
+    chunk[length++] = logicCapture.width();
+    for (int i = 0; i < 4; i++) chunk[length++] = (count >> (8 * i)) & 0xFF;
+    for (int i = 0; i < 4; i++) chunk[length++] = (overwritten >> (8 * i)) & 0xFF;
+    for (uint8_t c = 0; c < logicCapture.channels(); c++) {
+        uint8_t nameLength = strlen(logicCapture.channelName(c));
+        chunk[length++] = nameLength;
+        memcpy(chunk + length, logicCapture.channelName(c), nameLength);
+        length += nameLength;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        const CaptureSample& sample = logicCapture.sample(i);
+        for (int b = 0; b < 4; b++) chunk[length++] = (sample.timeUs >> (8 * b)) & 0xFF;
+        chunk[length++] = sample.channel;
+        chunk[length++] = sample.value;
+
+        if (length > (int)sizeof(chunk) - 8) {
+            server.sendContent((const char*)chunk, length);
+            length = 0;
+        }
+    }
+
+    if (length > 0) {
+        server.sendContent((const char*)chunk, length);
+    }
+    server.sendContent("");
+}
+
+// Read statistics of the front end, plus the lid servo's idle time
+String TaskSchedulerWebServer::statsToJson() {
+    DynamicJsonDocument doc(4096); // Adjust size based on the number of readers
+
+#if RFID_FRONTEND == RFID_FRONTEND_FDXB_UART
+    // UART receive counters of the FDX-B module
+    const RfidUartStats& uartStats = rfidUart.getStats();
+
+    doc["lines"] = uartStats.lines;
+    doc["droppedLines"] = uartStats.droppedLines;
+    doc["fifoOverflows"] = uartStats.fifoOverflows;
+    doc["bufferOverflows"] = uartStats.bufferOverflows;
+    doc["framingErrors"] = uartStats.framingErrors;
+    doc["parityErrors"] = uartStats.parityErrors;
+#else
+    // One object per reader, card IDs as decimal strings like /get-pets
+    JsonArray readersArray = doc.createNestedArray("readers");
+    unsigned long now = millis();
+
+    for (int r = 0; r < rfidFrontEnd.readerCount(); r++) {
+        const ReadStats* stats = &rfidFrontEnd.stats(r);
+        unsigned long elapsed = now - stats->startTime();
+
+        JsonObject reader = readersArray.createNestedObject();
+        reader["reader"] = r;
+        reader["seconds"] = elapsed / 1000;
+        reader["decoded"] = stats->decoded();
+        reader["parityFailures"] = stats->parityFailed();
+        reader["truncated"] = stats->truncated();
+        reader["overlong"] = stats->overlong();
+        reader["droppedEdges"] = rfidFrontEnd.reader(r)->droppedEdges();
+
+        // Only the frame lengths that occurred, keyed by bit count
+        JsonObject bitCounts = reader.createNestedObject("bitCounts");
+        for (int bits = 0; bits <= WIEGAND_MAX_BITS + 1; bits++) {
+            if (stats->framesOfLength(bits) > 0) {
+                bitCounts[String(bits)] = stats->framesOfLength(bits);
+            }
+        }
+
+        JsonArray cardsArray = reader.createNestedArray("cards");
+        for (int i = 0; i < stats->trackedCards(); i++) {
+            const CardReadStats& cardStats = stats->card(i);
+            char cardId[21];
+            snprintf(cardId, sizeof(cardId), "%llu", (unsigned long long)cardStats.cardId);
+
+            JsonObject card = cardsArray.createNestedObject();
+            card["card"] = cardId; // Copied into the document
+            card["reads"] = cardStats.reads;
+            card["readsPerMinute"] = elapsed > 0 ? cardStats.reads * 60000.0 / elapsed : 0;
+            card["secondsSinceRead"] = (now - cardStats.lastRead) / 1000;
+        }
+    }
+#endif
+
+    // Time the lid servo spent without pulses, and the holding power that saved
+    JsonObject servo = doc.createNestedObject("servo");
+    uint64_t idleMs = myServo.idleMillis();
+    servo["pulsing"] = myServo.isPulsing();
+    servo["idleOffs"] = myServo.idleOffs();
+    servo["idleSeconds"] = (uint32_t)(idleMs / 1000);
+    servo["energySavedJ"] = idleMs * LID_SERVO_HOLD_MW / 1000000.0;
+
+    // Which source holds the lid, and how often it actually had to move
+    static const char* const lidSources[LID_SOURCE_COUNT] = { "idle", "schedule", "tag", "button" };
+    JsonObject lid = doc.createNestedObject("lid");
+    lid["open"] = lidArbiter.isOpen();
+    lid["heldBy"] = lidSources[lidArbiter.winner()];
+    lid["actuations"] = lidArbiter.actuationCount();
+
+    // Progress of the current or last dispense
+    static const char* const dispensePhases[] = { "idle", "forward", "backward", "stopping" };
+    JsonObject dispense = doc.createNestedObject("dispense");
+    dispense["phase"] = dispensePhases[dispenser.currentPhase()];
+    dispense["paused"] = dispenser.isPaused();
+    dispense["steps"] = dispenser.dispensedSteps();
+    dispense["targetSteps"] = dispenser.target();
+    dispense["cycles"] = dispenser.cycles();
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    return jsonString;
+}
@@ -6,6 +6,8 @@
 #include <ArduinoJson.h>
 #include <Preferences.h>  // For persistent storage
 #include "stepper_control.h"  // For the scheduledTasks array
+#include "tag_table.h"        // For the authorized pets
+#include "logic_capture.h"    // For the diagnostic capture download
 
 class TaskSchedulerWebServer {
 private:
@@ -20,6 +22,14 @@ private:
     void handleRoot();
     void handleGetTasks();
     void handleSaveTasks();
+    void handleGetPets();
+    void handleSavePets();
+    void handleStartCapture();
+    void handleStopCapture();
+    void handleGetCapture();
+    void handleGetStats();
+    void handleResetStats();
+    void handleDispense();
     void handleNotFound();
 
     // Method to apply task updates to the scheduledTasks array
@@ -28,6 +38,17 @@ private:
     // Method to convert scheduledTasks to JSON
     String tasksToJson();
 
+    // Methods to convert between the tag table and JSON
+    bool updatePets(const JsonArray& petsArray);
+    String petsToJson();
+
+    // Method to convert the RFID front end's statistics to JSON
+    String statsToJson();
+
+    // Methods to stream the logic capture in chunks
+    void sendCaptureVcd();
+    void sendCaptureBinary();
+
     // Methods for persistent storage
     bool saveTasks();
     bool loadTasks();
@@ -0,0 +1,164 @@
+#ifndef WIEGAND_FORMAT_H
+#define WIEGAND_FORMAT_H
+
+#include <stdint.h>
+
+// Compile-time Wiegand format descriptors.
+// A frame is assembled MSB first into a uint64_t, so the first transmitted bit
+// of an N-bit frame ends up at bit N-1. Field and parity positions below are
+// given in transmission order (0 = first bit on the wire).
+
+// Decoded card fields
+typedef struct {
+  const char* format;       // Format name, e.g. "H10301"
+  uint8_t bitCount;         // Frame length
+  uint32_t facilityCode;    // Facility / company code
+  uint32_t cardNumber;      // Card number within the facility
+  uint64_t id;              // facilityCode << 32 | cardNumber, unique per card
+} WiegandCard;
+
+// One parity check: the covered bits, including the parity bit itself,
+// must contain an even (odd = false) or odd (odd = true) number of ones
+typedef struct {
+  uint8_t position;   // Frame position of the parity bit
+  uint64_t mask;
+  bool odd;
+} ParityRule;
+
+// Mask of frame positions first..last (inclusive) in an LENGTH-bit frame
+constexpr uint64_t frameRange(uint8_t length, uint8_t first, uint8_t last) {
+  return first > last ? 0 : ((1ULL << (length - first - 1)) | frameRange(length, first + 1, last));
+}
+
+// Mask of frame positions first..last whose position modulo 3 is not skip
+// (Corporate 1000 interleaves its parity groups this way)
+constexpr uint64_t frameRangeSkipMod3(uint8_t length, uint8_t first, uint8_t last, uint8_t skip) {
+  return first > last ? 0 : ((first % 3 != skip ? (1ULL << (length - first - 1)) : 0) |
+                             frameRangeSkipMod3(length, first + 1, last, skip));
+}
+
+constexpr uint64_t lowBits(uint8_t width) {
+  return width >= 64 ? ~0ULL : ((1ULL << width) - 1);
+}
+
+// Field layout shared by every format: fixed length and two contiguous fields
+template <uint8_t LENGTH, uint8_t FACILITY_FIRST, uint8_t FACILITY_BITS, uint8_t CARD_FIRST, uint8_t CARD_BITS>
+struct WiegandLayout {
+  static_assert(LENGTH <= 64, "Wiegand frames are assembled into 64 bits");
+  static_assert(FACILITY_FIRST + FACILITY_BITS <= LENGTH && CARD_FIRST + CARD_BITS <= LENGTH,
+                "Field runs past the end of the frame");
+
+  static constexpr uint8_t length = LENGTH;
+
+  static constexpr uint32_t facilityCode(uint64_t bits) {
+    return (uint32_t)((bits >> (LENGTH - FACILITY_FIRST - FACILITY_BITS)) & lowBits(FACILITY_BITS));
+  }
+
+  static constexpr uint32_t cardNumber(uint64_t bits) {
+    return (uint32_t)((bits >> (LENGTH - CARD_FIRST - CARD_BITS)) & lowBits(CARD_BITS));
+  }
+
+  // Frame with both fields filled in and every parity bit clear
+  static constexpr uint64_t fields(uint32_t facility, uint32_t card) {
+    return (((uint64_t)facility & lowBits(FACILITY_BITS)) << (LENGTH - FACILITY_FIRST - FACILITY_BITS)) |
+           (((uint64_t)card & lowBits(CARD_BITS)) << (LENGTH - CARD_FIRST - CARD_BITS));
+  }
+};
+
+// HID H10301 26-bit: P | 8-bit facility | 16-bit card | P
+struct H10301 : WiegandLayout<26, 1, 8, 9, 16> {
+  static constexpr const char* name = "H10301";
+  static constexpr ParityRule parity[] = {
+    { 0, frameRange(26, 0, 12), false },
+    { 25, frameRange(26, 13, 25), true },
+  };
+};
+
+// HID H10306 34-bit: P | 16-bit facility | 16-bit card | P
+struct H10306 : WiegandLayout<34, 1, 16, 17, 16> {
+  static constexpr const char* name = "H10306";
+  static constexpr ParityRule parity[] = {
+    { 0, frameRange(34, 0, 16), false },
+    { 33, frameRange(34, 17, 33), true },
+  };
+};
+
+// HID Corporate 1000 35-bit: P | P | 12-bit company | 20-bit card | P.
+// Bit 0 is odd parity over the whole frame, so it is checked last.
+struct Corporate1000 : WiegandLayout<35, 2, 12, 14, 20> {
+  static constexpr const char* name = "C1000-35";
+  static constexpr ParityRule parity[] = {
+    { 1, frameRange(35, 1, 1) | frameRangeSkipMod3(35, 2, 33, 1), false },
+    { 34, frameRangeSkipMod3(35, 1, 32, 0) | frameRange(35, 34, 34), true },
+    { 0, frameRange(35, 0, 34), true },
+  };
+};
+
+// HID H10304 37-bit: P | 16-bit facility | 19-bit card | P
+struct H10304 : WiegandLayout<37, 1, 16, 17, 19> {
+  static constexpr const char* name = "H10304";
+  static constexpr ParityRule parity[] = {
+    { 0, frameRange(37, 0, 18), false },
+    { 36, frameRange(37, 18, 36), true },
+  };
+};
+
+// Check every parity rule of FORMAT with one masked popcount each
+template <typename FORMAT>
+inline bool checkFormatParity(uint64_t bits) {
+  for (const ParityRule& rule : FORMAT::parity) {
+    if ((__builtin_popcountll(bits & rule.mask) & 1) != (rule.odd ? 1 : 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Build a valid frame: fill in the fields, then set each parity bit as needed.
+// Rules are solved in order, later parity bits are never covered by earlier rules.
+template <typename FORMAT>
+inline uint64_t encodeWiegandAs(uint32_t facility, uint32_t card) {
+  uint64_t bits = FORMAT::fields(facility, card);
+  for (const ParityRule& rule : FORMAT::parity) {
+    if ((__builtin_popcountll(bits & rule.mask) & 1) != (rule.odd ? 1 : 0)) {
+      bits |= 1ULL << (FORMAT::length - rule.position - 1);
+    }
+  }
+  return bits;
+}
+
+template <typename FORMAT>
+inline bool decodeWiegandAs(uint64_t bits, WiegandCard& card) {
+  if (!checkFormatParity<FORMAT>(bits)) {
+    return false;
+  }
+  card.format = FORMAT::name;
+  card.bitCount = FORMAT::length;
+  card.facilityCode = FORMAT::facilityCode(bits);
+  card.cardNumber = FORMAT::cardNumber(bits);
+  card.id = ((uint64_t)card.facilityCode << 32) | card.cardNumber;
+  return true;
+}
+
+// True if some supported format has this frame length
+inline bool isWiegandFrameLength(int bitCount) {
+  return bitCount == H10301::length || bitCount == H10306::length ||
+         bitCount == Corporate1000::length || bitCount == H10304::length;
+}
+
+// Longest supported frame, anything longer is over-long rather than truncated
+static const uint8_t WIEGAND_LONGEST_FORMAT = H10304::length;
+
+// Pick the format from the frame length and decode. Returns false for
+// unsupported lengths and parity failures.
+inline bool decodeWiegandFrame(uint64_t bits, uint8_t bitCount, WiegandCard& card) {
+  switch (bitCount) {
+    case H10301::length:        return decodeWiegandAs<H10301>(bits, card);
+    case H10306::length:        return decodeWiegandAs<H10306>(bits, card);
+    case Corporate1000::length: return decodeWiegandAs<Corporate1000>(bits, card);
+    case H10304::length:        return decodeWiegandAs<H10304>(bits, card);
+    default:                    return false;
+  }
+}
+
+#endif //WIEGAND_FORMAT_H
@@ -0,0 +1,162 @@
+#include "rfid_frontend.h"
+
+#if RFID_FRONTEND != RFID_FRONTEND_FDXB_UART
+
+#include "logic_capture.h"
+
+// Everything kept for one reader, so enabling a reader can't leave its
+// statistics or presence tracking out
+struct WiegandChannel {
+    WiegandReaderBase& reader;
+    ReadStats stats;               // Read quality
+    PresenceTracker presence;      // Authorized pet at the reader's bowl
+    uint32_t lastDroppedEdges;     // droppedEdges() when last reported
+    bool activityReported;         // Activity on the frame being assembled was logged
+
+    explicit WiegandChannel(WiegandReaderBase& reader)
+        : reader(reader),
+          presence(PRESENCE_INITIAL_INTERVAL_MS, PRESENCE_MIN_TIMEOUT_MS, PRESENCE_MAX_TIMEOUT_MS, PRESENCE_ARRIVE_READS),
+          lastDroppedEdges(0), activityReported(false) {}
+};
+
+// Readers, the index each is given must be its position in wiegandChannels
+static WiegandReader<DATA0_PIN, DATA1_PIN> reader0(0);
+// static WiegandReader<READER1_DATA0_PIN, READER1_DATA1_PIN> reader1(1);
+
+static WiegandChannel wiegandChannels[] = {
+    WiegandChannel(reader0),
+    // WiegandChannel(reader1),
+};
+static const int WIEGAND_READER_COUNT = sizeof(wiegandChannels) / sizeof(wiegandChannels[0]);
+
+static_assert(WIEGAND_READER_COUNT <= MAX_RFID_READERS, "More Wiegand readers than MAX_RFID_READERS");
+
+// Logic capture channels: DATA0 and DATA1 of each reader, in reader order
+static const char* const captureChannels[MAX_RFID_READERS * 2] = {
+    "reader0_data0", "reader0_data1", "reader1_data0", "reader1_data1",
+    "reader2_data0", "reader2_data1", "reader3_data0", "reader3_data1",
+};
+
+RfidFrontEnd rfidFrontEnd;
+
+WiegandFrontEnd::WiegandFrontEnd()
+    : pollIndex(0), lastBits(0), lastBitCount(0) {
+    memset(&lastCard, 0, sizeof(lastCard));
+}
+
+// Start capture on every reader
+bool WiegandFrontEnd::begin() {
+    logicCapture.setChannels(captureChannels, WIEGAND_READER_COUNT * 2, 1);
+
+    bool allStarted = true;
+    for (int i = 0; i < WIEGAND_READER_COUNT; i++) {
+        if (!wiegandChannels[i].reader.begin()) {
+            Serial.print("Failed to start Wiegand reader ");
+            Serial.println(i);
+            allStarted = false;
+        }
+    }
+
+    if (allStarted) {
+        Serial.print("Wiegand readers started: ");
+        Serial.println(WIEGAND_READER_COUNT);
+    }
+    return allStarted;
+}
+
+int WiegandFrontEnd::readerCount() const {
+    return WIEGAND_READER_COUNT;
+}
+
+// Poll the readers in turn: decode queued edges and hand out frames that closed.
+// Each reader is polled once per drain, a reader with another frame queued
+// delivers it on the next loop().
+bool WiegandFrontEnd::nextRead(TagRead& read) {
+    while (pollIndex < WIEGAND_READER_COUNT) {
+        WiegandChannel& channel = wiegandChannels[pollIndex++];
+        WiegandReaderBase* reader = &channel.reader;
+
+        reader->poll();
+
+        // Check if any interrupt activity happened recently
+        if (reader->bitCount() > 0 && !channel.activityReported) {
+            channel.activityReported = true;
+            Serial.print("*** RFID activity detected on reader ");
+            Serial.print(reader->index());
+            Serial.println("! ***");
+            Serial.print("Current bit count: ");
+            Serial.println(reader->bitCount());
+        }
+
+        // Report edges lost because the loop fell a full ring behind
+        if (reader->droppedEdges() != channel.lastDroppedEdges) {
+            channel.lastDroppedEdges = reader->droppedEdges();
+            Serial.print("WARNING: Edge ring overflow on reader ");
+            Serial.print(reader->index());
+            Serial.print(", dropped edges: ");
+            Serial.println(channel.lastDroppedEdges);
+        }
+
+        if (!reader->frameReady()) {
+            continue;
+        }
+
+        read.reader = reader->index();
+        read.valid = reader->decode(lastCard);
+        read.tagId = read.valid ? lastCard.id : 0;
+        lastBits = reader->bits();
+        lastBitCount = reader->bitCount();
+        channel.stats.recordFrame(lastBitCount, read.valid ? &lastCard : NULL, millis());
+
+        reader->reset();
+        channel.activityReported = false;
+        return true;
+    }
+
+    pollIndex = 0;
+    return false;
+}
+
+void WiegandFrontEnd::printRead(const TagRead& read) {
+    Serial.print("CARD READ COMPLETE - Reader: ");
+    Serial.print(read.reader);
+    Serial.print(", Received bits: ");
+    Serial.println(lastBitCount);
+    Serial.print("Raw data (HEX): ");
+    Serial.println(lastBits, HEX);
+
+    if (read.valid) {
+        // Print the decoded fields of whichever format matched the frame length
+        Serial.print("Format: ");
+        Serial.println(lastCard.format);
+        Serial.print("Facility Code: ");
+        Serial.println(lastCard.facilityCode);
+        Serial.print("Card Number: ");
+        Serial.println(lastCard.cardNumber);
+    }
+}
+
+// Edges are queued by the ISRs or the RMT, give a little time for other processes
+void WiegandFrontEnd::idle() {
+    delay(1);
+}
+
+void WiegandFrontEnd::resetStats() {
+    for (int r = 0; r < WIEGAND_READER_COUNT; r++) {
+        wiegandChannels[r].stats.reset(millis());
+    }
+}
+
+WiegandReaderBase* WiegandFrontEnd::reader(int i) const {
+    return &wiegandChannels[i].reader;
+}
+
+const ReadStats& WiegandFrontEnd::stats(int i) const {
+    return wiegandChannels[i].stats;
+}
+
+PresenceTracker& WiegandFrontEnd::presence(int i) {
+    return wiegandChannels[i].presence;
+}
+
+#endif // RFID_FRONTEND != RFID_FRONTEND_FDXB_UART
@@ -0,0 +1,47 @@
+#ifndef WIEGAND_FRONTEND_H
+#define WIEGAND_FRONTEND_H
+
+#include <Arduino.h>
+#include "state.h"
+#include "tag_read.h"
+#include "wiegand_reader.h"
+#include "read_stats.h"
+#include "presence_tracker.h"
+
+// Additional readers (one per bowl antenna) - DATA0/DATA1 pin pairs
+// #define READER1_DATA0_PIN 5
+// #define READER1_DATA1_PIN 6
+
+// Presence detection (see presence_tracker.h)
+#define PRESENCE_INITIAL_INTERVAL_MS 500  // Assumed repeat interval until the reader's is learned
+#define PRESENCE_MIN_TIMEOUT_MS 300       // Never close sooner than this after the last read
+#define PRESENCE_MAX_TIMEOUT_MS 2000      // Worst case, the previous fixed tag timeout
+#define PRESENCE_ARRIVE_READS 2           // Reads in a row before a pet counts as arrived
+
+// Wiegand readers captured through pin ISRs or the RMT (WIEGAND_CAPTURE_MODE).
+// Every reader is polled once per loop(), a closed frame becomes one TagRead.
+class WiegandFrontEnd {
+private:
+    int pollIndex;                      // Next reader nextRead() polls
+
+    // The frame behind the last TagRead, for printRead()
+    WiegandCard lastCard;
+    uint64_t lastBits;
+    int lastBitCount;
+
+public:
+    WiegandFrontEnd();
+
+    bool begin();
+    int readerCount() const;
+    bool nextRead(TagRead& read);
+    void printRead(const TagRead& read);
+    void idle();
+    void resetStats();
+
+    WiegandReaderBase* reader(int i) const;
+    const ReadStats& stats(int i) const;
+    PresenceTracker& presence(int i);
+};
+
+#endif //WIEGAND_FRONTEND_H
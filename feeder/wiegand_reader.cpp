@@ -0,0 +1,117 @@
+#include "wiegand_reader.h"
+
+WiegandReaderBase::WiegandReaderBase(uint8_t index, uint8_t pin0, uint8_t pin1, void (*isr0)(), void (*isr1)())
+    : readerIndex(index), data0Pin(pin0), data1Pin(pin1), isrData0(isr0), isrData1(isr1),
+      risePending(0), frameGapTimer(NULL), frameBits(0), recvBitCount(0), isCardReadOver(false), verbose(DEBUG) {
+    lineGpio[0] = 0;
+    lineGpio[1] = 0;
+    portMUX_INITIALIZE(&captureLock);
+}
+
+// The line has been quiet for WIEGAND_FRAME_GAP_US - close the frame at the
+// current end of the edge ring, whatever its length
+void WiegandReaderBase::onFrameGap(void* arg) {
+    WiegandReaderBase* reader = (WiegandReaderBase*)arg;
+    reader->frameEndRing.push(reader->edgeRing.pushedCount());
+
+    // The lines are idle by now, close the capture's last pulses
+    portENTER_CRITICAL_SAFE(&reader->captureLock);
+    reader->captureRises(micros());
+    portEXIT_CRITICAL_SAFE(&reader->captureLock);
+}
+
+bool WiegandReaderBase::begin() {
+    pinMode(data0Pin, INPUT_PULLUP);    // Add pull-up to help with noise
+    pinMode(data1Pin, INPUT_PULLUP);    // Add pull-up to help with noise
+
+#if WIEGAND_CAPTURE_MODE == WIEGAND_CAPTURE_RMT
+    // Let the RMT peripheral record both data lines
+    return rmtCapture.begin(data0Pin, data1Pin, readerIndex * 2);
+#else
+    lineGpio[0] = digitalPinToGPIONumber(data0Pin);
+    lineGpio[1] = digitalPinToGPIONumber(data1Pin);
+
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = onFrameGap;
+    timerArgs.arg = this;
+    timerArgs.name = "wiegandGap";
+    if (esp_timer_create(&timerArgs, &frameGapTimer) != ESP_OK) {
+        return false;
+    }
+
+    attachInterrupt(digitalPinToInterrupt(data0Pin), isrData0, FALLING);
+    attachInterrupt(digitalPinToInterrupt(data1Pin), isrData1, FALLING);
+    return true;
+#endif
+}
+
+// Shift one received bit into the frame being assembled
+void WiegandReaderBase::receiveBit(byte bit) {
+    // Bits past the longest supported frame are only counted, the frame is
+    // rejected by length when it closes
+    if (recvBitCount < WIEGAND_MAX_BITS) {
+        frameBits = (frameBits << 1) | bit;
+    }
+    recvBitCount++;
+
+    if (verbose && (recvBitCount % 8 == 0)) {
+        Serial.print("Reader ");
+        Serial.print(readerIndex);
+        Serial.print(" received ");
+        Serial.print(recvBitCount);
+        Serial.print(" bits - Current data: ");
+        Serial.println(frameBits, HEX);
+    }
+}
+
+// Decode queued edges in batches up to the next frame end reported by the
+// gap timer, so that edges of the following frame stay queued.
+// Returns the number of edges consumed.
+int WiegandReaderBase::poll() {
+#if WIEGAND_CAPTURE_MODE == WIEGAND_CAPTURE_RMT
+    // Queue pulse trains the RMT has finished recording
+    rmtCapture.poll(edgeRing, frameEndRing);
+#endif
+
+    WiegandEdge edges[EDGE_BATCH_SIZE];
+    int consumed = 0;
+
+    while (!isCardReadOver) {
+        uint16_t wanted = EDGE_BATCH_SIZE;
+        uint16_t frameEnd;
+        if (frameEndRing.peek(frameEnd)) {
+            int16_t remaining = (int16_t)(frameEnd - edgeRing.poppedCount());
+            if (remaining <= 0) {
+                // Every edge of the closed frame has been decoded
+                frameEndRing.popBatch(&frameEnd, 1);
+                isCardReadOver = recvBitCount > 0;
+                continue;
+            }
+            if (remaining < wanted) wanted = remaining;
+        }
+
+        uint16_t count = edgeRing.popBatch(edges, wanted);
+        if (count == 0) break;
+
+        for (uint16_t i = 0; i < count; i++) {
+            receiveBit(edges[i].bit);
+        }
+        consumed += count;
+    }
+
+    return consumed;
+}
+
+// Decode the closed frame with the format matching its length
+bool WiegandReaderBase::decode(WiegandCard& card) const {
+    if (recvBitCount > WIEGAND_MAX_BITS) {
+        return false;
+    }
+    return decodeWiegandFrame(frameBits, recvBitCount, card);
+}
+
+void WiegandReaderBase::reset() {
+    frameBits = 0;
+    recvBitCount = 0;
+    isCardReadOver = false;
+}
@@ -0,0 +1,147 @@
+#ifndef WIEGAND_READER_H
+#define WIEGAND_READER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <soc/gpio_struct.h>
+#include "state.h"
+#include "edge_ring.h"
+#include "logic_capture.h"
+#include "wiegand_format.h"
+#include "wiegand_rmt.h"
+
+#define WIEGAND_MAX_BITS 64         // Longest frame that can be assembled
+#define WIEGAND_FRAME_GAP_US 5000   // Line quiet this long closes a frame (must exceed the reader's bit interval)
+#define EDGE_BATCH_SIZE 16          // Edges drained from the ring per batch
+
+// Capture and frame assembly state of one Wiegand reader.
+// Use WiegandReader<DATA0, DATA1> to create one, it provides the ISRs.
+class WiegandReaderBase {
+private:
+    const uint8_t readerIndex;
+    const uint8_t data0Pin;
+    const uint8_t data1Pin;
+    void (*const isrData0)();
+    void (*const isrData1)();
+    uint8_t lineGpio[2];             // GPIO numbers of DATA0/DATA1, for reading the level in the ISRs
+
+    // Logic capture of the falling edge interrupts: lines that fell and have
+    // not been seen high since (bit 0 DATA0, bit 1 DATA1)
+    uint8_t risePending;
+    portMUX_TYPE captureLock;
+
+    // Edges captured by the ISRs, waiting to be decoded by poll()
+    EdgeRing edgeRing;
+    FrameEndRing frameEndRing;
+#if WIEGAND_CAPTURE_MODE == WIEGAND_CAPTURE_RMT
+    WiegandRmtCapture rmtCapture;
+#endif
+
+    // One-shot timer re-armed by every edge, fires once the line goes quiet
+    esp_timer_handle_t frameGapTimer;
+
+    // Frame being assembled
+    uint64_t frameBits;      // Received bits, first bit most significant
+    int recvBitCount;
+    bool isCardReadOver;
+
+    bool verbose;            // Print assembly progress (DEBUG builds)
+
+    static void onFrameGap(void* arg);
+    void receiveBit(byte bit);
+
+    uint8_t IRAM_ATTR captureChannel(byte bit) const { return readerIndex * 2 + bit; }
+
+    // Record the rise of every line that fell earlier and reads high now.
+    // Under captureLock.
+    void IRAM_ATTR captureRises(uint32_t nowUs) {
+        for (byte bit = 0; bit < 2; bit++) {
+            if ((risePending & (1 << bit)) && gpioLevel(lineGpio[bit])) {
+                logicCapture.record(nowUs, captureChannel(bit), 1);
+                risePending &= ~(1 << bit);
+            }
+        }
+    }
+
+    // The interrupt only fires on the fall, so a line's rise is recorded when
+    // it is first seen high again - by this fall, the next edge of the reader
+    // or the frame gap. The recorded rise is at or after the real one.
+    void IRAM_ATTR captureFall(byte bit, uint32_t nowUs) {
+        portENTER_CRITICAL_SAFE(&captureLock);
+        if (risePending & (1 << bit)) {
+            // Fell again, so it rose in between
+            logicCapture.record(nowUs, captureChannel(bit), 1);
+            risePending &= ~(1 << bit);
+        }
+        captureRises(nowUs);
+        logicCapture.record(nowUs, captureChannel(bit), 0);
+        if (gpioLevel(lineGpio[bit])) {
+            logicCapture.record(nowUs, captureChannel(bit), 1);
+            risePending &= ~(1 << bit);
+        } else {
+            risePending |= 1 << bit;
+        }
+        portEXIT_CRITICAL_SAFE(&captureLock);
+    }
+
+    static inline uint8_t IRAM_ATTR gpioLevel(uint8_t gpio) {
+        return gpio < 32 ? (GPIO.in >> gpio) & 1 : (GPIO.in1.data >> (gpio - 32)) & 1;
+    }
+
+protected:
+    WiegandReaderBase(uint8_t index, uint8_t pin0, uint8_t pin1, void (*isr0)(), void (*isr1)());
+
+    // Called from the pin ISRs on the falling edge of a line. Every fall is
+    // one bit, whatever the line level reads by now. The logic capture is
+    // recorded after the bit is queued and never feeds the ring.
+    inline void IRAM_ATTR onEdge(byte bit) {
+        WiegandEdge edge = { ESP.getCycleCount(), bit };
+        edgeRing.push(edge);
+        esp_timer_stop(frameGapTimer); // Fails harmlessly if the timer is not running
+        esp_timer_start_once(frameGapTimer, WIEGAND_FRAME_GAP_US);
+
+        if (logicCapture.isArmed()) {
+            captureFall(bit, micros());
+        }
+    }
+
+public:
+    bool begin();
+    int poll();
+    bool decode(WiegandCard& card) const;
+    void reset();
+
+    uint8_t index() const { return readerIndex; }
+    bool frameReady() const { return isCardReadOver; }
+    int bitCount() const { return recvBitCount; }
+    uint64_t bits() const { return frameBits; }
+    uint32_t droppedEdges() const { return edgeRing.droppedCount(); }
+
+    void setVerbose(bool enabled) { verbose = enabled; }
+
+    // Feed synthetic edges and frame ends, as the ISRs and gap timer would (host/wiegand_host.cpp)
+    bool injectEdge(const WiegandEdge& edge) { return edgeRing.push(edge); }
+    void injectFrameEnd() { frameEndRing.push(edgeRing.pushedCount()); }
+};
+
+// A reader wired to a fixed DATA0/DATA1 pin pair. Every pin pair is its own
+// type, so each reader gets its own pair of ISR trampolines.
+template <uint8_t DATA0, uint8_t DATA1>
+class WiegandReader : public WiegandReaderBase {
+private:
+    static WiegandReader* instance;
+
+    static void IRAM_ATTR isrReceiveData0() { instance->onEdge(0); }
+    static void IRAM_ATTR isrReceiveData1() { instance->onEdge(1); }
+
+public:
+    explicit WiegandReader(uint8_t index)
+        : WiegandReaderBase(index, DATA0, DATA1, isrReceiveData0, isrReceiveData1) {
+        instance = this;
+    }
+};
+
+template <uint8_t DATA0, uint8_t DATA1>
+WiegandReader<DATA0, DATA1>* WiegandReader<DATA0, DATA1>::instance = NULL;
+
+#endif //WIEGAND_READER_H
@@ -0,0 +1,175 @@
+#include "wiegand_rmt.h"
+
+#if WIEGAND_CAPTURE_MODE == WIEGAND_CAPTURE_RMT
+
+#include <driver/gpio.h>
+#include <esp_timer.h>
+#include <soc/soc_caps.h>
+#include "logic_capture.h"
+
+// RMT ticks to microseconds in 32 bits, also for the longest pulse train
+static_assert(WIEGAND_RMT_RESOLUTION_HZ % 10000 == 0, "WIEGAND_RMT_RESOLUTION_HZ must be a multiple of 10kHz");
+#define RMT_TICKS_TO_US(ticks) ((uint32_t)(ticks) * 100 / (WIEGAND_RMT_RESOLUTION_HZ / 10000))
+
+static const rmt_receive_config_t rmtReceiveConfig = {
+    .signal_range_min_ns = WIEGAND_RMT_GLITCH_NS,
+    .signal_range_max_ns = WIEGAND_RMT_IDLE_US * 1000UL,
+};
+
+WiegandRmtCapture::WiegandRmtCapture()
+    : pendingEdgeCount(0), frameWindowStart(0), frameWindowOpen(false) {
+}
+
+// Runs in ISR context once per line per frame - only timestamp and flag it,
+// and hand the raw pulse train to the logic capture if it is armed
+bool IRAM_ATTR WiegandRmtCapture::onReceiveDone(rmt_channel_handle_t channel, const rmt_rx_done_event_data_t* edata, void* userCtx) {
+    RmtLineCapture* line = (RmtLineCapture*)userCtx;
+    line->doneMicros = esp_timer_get_time();
+    line->symbolCount = edata->num_symbols;
+    if (logicCapture.isArmed()) {
+        captureLine(line, edata->received_symbols, edata->num_symbols);
+    }
+    line->done = true;
+    return false;
+}
+
+// Record every level change of a pulse train, rising edges and pulses the
+// decoder would skip included. Timed back from the done callback like collectLine().
+void IRAM_ATTR WiegandRmtCapture::captureLine(const RmtLineCapture* line, const rmt_symbol_word_t* symbols, size_t symbolCount) {
+    uint32_t spanTicks = 0;
+    for (size_t i = 0; i < symbolCount; i++) {
+        spanTicks += symbols[i].duration0 + symbols[i].duration1;
+    }
+    uint32_t lastEdgeMicros = (uint32_t)(line->doneMicros - WIEGAND_RMT_IDLE_US);
+
+    uint32_t offsetTicks = 0;
+    uint8_t level = 1; // Lines idle high
+    for (size_t i = 0; i < symbolCount; i++) {
+        const rmt_symbol_word_t& symbol = symbols[i];
+        if (symbol.level0 != level) {
+            level = symbol.level0;
+            logicCapture.record(lastEdgeMicros - RMT_TICKS_TO_US(spanTicks - offsetTicks), line->captureChannel, level);
+        }
+        offsetTicks += symbol.duration0;
+        if (symbol.level1 != level) {
+            level = symbol.level1;
+            logicCapture.record(lastEdgeMicros - RMT_TICKS_TO_US(spanTicks - offsetTicks), line->captureChannel, level);
+        }
+        offsetTicks += symbol.duration1;
+    }
+}
+
+bool WiegandRmtCapture::setupLine(RmtLineCapture* line, int pin, byte bit, uint8_t captureChannel) {
+    line->bit = bit;
+    line->captureChannel = captureChannel;
+    line->done = false;
+
+    rmt_rx_channel_config_t channelConfig = {};
+    channelConfig.gpio_num = (gpio_num_t)digitalPinToGPIONumber(pin);
+    channelConfig.clk_src = RMT_CLK_SRC_DEFAULT;
+    channelConfig.resolution_hz = WIEGAND_RMT_RESOLUTION_HZ;
+    channelConfig.mem_block_symbols = SOC_RMT_MEM_WORDS_PER_CHANNEL;
+
+    if (rmt_new_rx_channel(&channelConfig, &line->channel) != ESP_OK) {
+        return false;
+    }
+    // Channel setup reconfigures the pad, restore the pull-up against noise
+    gpio_pullup_en(channelConfig.gpio_num);
+
+    rmt_rx_event_callbacks_t callbacks = {};
+    callbacks.on_recv_done = onReceiveDone;
+    if (rmt_rx_register_event_callbacks(line->channel, &callbacks, line) != ESP_OK) {
+        return false;
+    }
+    if (rmt_enable(line->channel) != ESP_OK) {
+        return false;
+    }
+    return rmt_receive(line->channel, line->symbols, sizeof(line->symbols), &rmtReceiveConfig) == ESP_OK;
+}
+
+bool WiegandRmtCapture::begin(int data0Pin, int data1Pin, uint8_t firstCaptureChannel) {
+    return setupLine(&lines[0], data0Pin, 0, firstCaptureChannel) &&
+           setupLine(&lines[1], data1Pin, 1, firstCaptureChannel + 1);
+}
+
+// Convert a finished pulse train to absolute edge timestamps and re-arm the channel.
+// The RMT reports durations relative to the first edge, the last edge is known to
+// be exactly one idle threshold before the done callback fired.
+void WiegandRmtCapture::collectLine(RmtLineCapture* line) {
+    size_t symbolCount = line->symbolCount;
+    int64_t lastEdgeMicros = line->doneMicros - WIEGAND_RMT_IDLE_US;
+    uint32_t cpuMHz = ESP.getCpuFreqMHz();
+
+    // Total length of the train in ticks, from first falling edge to last edge
+    uint32_t spanTicks = 0;
+    for (size_t i = 0; i < symbolCount; i++) {
+        spanTicks += line->symbols[i].duration0 + line->symbols[i].duration1;
+    }
+
+    uint32_t offsetTicks = 0;
+    for (size_t i = 0; i < symbolCount; i++) {
+        const rmt_symbol_word_t& symbol = line->symbols[i];
+        // Wiegand lines idle high, so every low level is one bit pulse
+        if (symbol.level0 == 0 && symbol.duration0 > 0 && pendingEdgeCount < 2 * WIEGAND_RMT_MAX_SYMBOLS) {
+            int64_t pulseMicros = lastEdgeMicros -
+                (int64_t)(spanTicks - offsetTicks) * 1000000 / WIEGAND_RMT_RESOLUTION_HZ;
+            WiegandEdge edge = { (uint32_t)(pulseMicros * cpuMHz), line->bit };
+            pendingEdges[pendingEdgeCount++] = edge;
+        }
+        offsetTicks += symbol.duration0 + symbol.duration1;
+    }
+
+    line->done = false;
+    rmt_receive(line->channel, line->symbols, sizeof(line->symbols), &rmtReceiveConfig);
+}
+
+// Collect finished pulse trains and, once both lines must have gone idle,
+// hand the merged frame to the decoder. Returns the number of edges queued.
+int WiegandRmtCapture::poll(EdgeRing& edgeRing, FrameEndRing& frameEndRing) {
+    // Sample the clock before the done flags so a line reporting in between
+    // is always picked up by the next poll rather than missed by this one
+    int64_t nowMicros = esp_timer_get_time();
+
+    for (int i = 0; i < 2; i++) {
+        if (lines[i].done) {
+            if (!frameWindowOpen) {
+                frameWindowOpen = true;
+                frameWindowStart = lines[i].doneMicros;
+            }
+            collectLine(&lines[i]);
+        }
+    }
+
+    // The other line's last pulse is at most one idle threshold after this
+    // line's last edge, so it reports within one more threshold (or never,
+    // if every bit of the frame was on the first line)
+    if (!frameWindowOpen || nowMicros - frameWindowStart < WIEGAND_RMT_IDLE_US) {
+        return 0;
+    }
+
+    // Restore transmission order across the two lines (insertion sort, frames are short)
+    for (int i = 1; i < pendingEdgeCount; i++) {
+        WiegandEdge edge = pendingEdges[i];
+        int j = i - 1;
+        while (j >= 0 && (int32_t)(pendingEdges[j].cycles - edge.cycles) > 0) {
+            pendingEdges[j + 1] = pendingEdges[j];
+            j--;
+        }
+        pendingEdges[j + 1] = edge;
+    }
+
+    int queued = 0;
+    for (int i = 0; i < pendingEdgeCount; i++) {
+        if (edgeRing.push(pendingEdges[i])) {
+            queued++;
+        }
+    }
+    // Both lines are idle, the frame is complete
+    frameEndRing.push(edgeRing.pushedCount());
+
+    pendingEdgeCount = 0;
+    frameWindowOpen = false;
+    return queued;
+}
+
+#endif // WIEGAND_CAPTURE_MODE == WIEGAND_CAPTURE_RMT
@@ -0,0 +1,57 @@
+#ifndef WIEGAND_RMT_H
+#define WIEGAND_RMT_H
+
+#include <Arduino.h>
+#include "state.h"
+#include "edge_ring.h"
+
+// RMT capture backend: each data line gets its own RMT receive channel which
+// records the whole pulse train in hardware. The CPU is only involved once
+// per line per frame, when the channel reports the line has gone idle.
+// Every reader needs two RX channels (the ESP32-S3 has four).
+#define WIEGAND_RMT_RESOLUTION_HZ 400000  // 2.5us ticks, long enough range for the idle threshold
+#define WIEGAND_RMT_IDLE_US 80000         // Quiet time that ends a pulse train (must exceed the longest same-line gap in a frame)
+#define WIEGAND_RMT_GLITCH_NS 2000        // Pulses shorter than this are filtered out in hardware
+#define WIEGAND_RMT_MAX_SYMBOLS 64        // Pulses buffered per line per frame
+
+#if WIEGAND_CAPTURE_MODE == WIEGAND_CAPTURE_RMT
+
+#include <driver/rmt_rx.h>
+
+class WiegandRmtCapture {
+private:
+    // Capture state for one data line
+    typedef struct {
+        rmt_channel_handle_t channel;
+        rmt_symbol_word_t symbols[WIEGAND_RMT_MAX_SYMBOLS];
+        volatile size_t symbolCount;   // Written by the receive-done callback
+        volatile int64_t doneMicros;   // When the line was reported idle
+        volatile bool done;
+        byte bit;                      // Bit value a pulse on this line represents
+        uint8_t captureChannel;        // Logic capture channel of the line
+    } RmtLineCapture;
+
+    RmtLineCapture lines[2];
+
+    // Pulses of the frame being collected, merged from both lines
+    WiegandEdge pendingEdges[2 * WIEGAND_RMT_MAX_SYMBOLS];
+    int pendingEdgeCount;
+    int64_t frameWindowStart;
+    bool frameWindowOpen;
+
+    static bool IRAM_ATTR onReceiveDone(rmt_channel_handle_t channel, const rmt_rx_done_event_data_t* edata, void* userCtx);
+    static void IRAM_ATTR captureLine(const RmtLineCapture* line, const rmt_symbol_word_t* symbols, size_t symbolCount);
+    bool setupLine(RmtLineCapture* line, int pin, byte bit, uint8_t captureChannel);
+    void collectLine(RmtLineCapture* line);
+
+public:
+    WiegandRmtCapture();
+
+    // Logic capture channels firstCaptureChannel (DATA0) and the one after (DATA1)
+    bool begin(int data0Pin, int data1Pin, uint8_t firstCaptureChannel);
+    int poll(EdgeRing& edgeRing, FrameEndRing& frameEndRing);
+};
+
+#endif // WIEGAND_CAPTURE_MODE == WIEGAND_CAPTURE_RMT
+
+#endif //WIEGAND_RMT_H
@@ -0,0 +1,74 @@
+#ifndef WIEGAND_SIM_H
+#define WIEGAND_SIM_H
+
+#include <stdint.h>
+#include "wiegand_format.h"
+
+// Synthetic Wiegand pulse-train generator. Produces the falling edges a
+// reader would put on DATA0/DATA1, with configurable timing and faults.
+// Has no Arduino dependencies so it can also be built on a host.
+
+// One simulated falling edge
+typedef struct {
+  uint32_t timeUs;   // Time of the edge since the start of the run
+  uint8_t bit;       // 0 = pulse on DATA0, 1 = pulse on DATA1
+} WiegandSimEdge;
+
+typedef struct {
+  uint32_t pulseWidthUs;     // Low time of each pulse, noise never starts inside one
+  uint32_t bitIntervalUs;    // Nominal time between the start of two bits
+  uint32_t jitterUs;         // Each interval varies by up to +/- this much
+  uint16_t dropPerMille;     // Chance a bit never makes it onto the wire
+  uint16_t glitchPerMille;   // Chance of a spurious noise pulse after a bit
+  uint32_t frameGapUs;       // Quiet time after each frame
+} WiegandSimConfig;
+
+class WiegandPulseSim {
+private:
+  uint32_t rngState;
+
+public:
+  explicit WiegandPulseSim(uint32_t seed) : rngState(seed ? seed : 1) {}
+
+  // xorshift32 - fast and deterministic, so runs are reproducible
+  uint32_t random() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+  }
+
+  bool chance(uint16_t perMille) {
+    return perMille > 0 && random() % 1000 < perMille;
+  }
+
+  // Generate the edges of one frame starting at startUs. Returns the number
+  // of edges written, endUs receives the time at which the line is quiet again.
+  int generate(uint64_t bits, uint8_t bitCount, const WiegandSimConfig& config,
+               uint32_t startUs, WiegandSimEdge* out, int maxEdges, uint32_t& endUs) {
+    int count = 0;
+    uint32_t t = startUs;
+
+    for (int i = bitCount - 1; i >= 0; i--) {
+      uint8_t bit = (bits >> i) & 1;
+
+      if (!chance(config.dropPerMille) && count < maxEdges) {
+        WiegandSimEdge edge = { t, bit };
+        out[count++] = edge;
+      }
+      // Noise pulse on a random line somewhere inside the bit interval
+      if (chance(config.glitchPerMille) && count < maxEdges) {
+        WiegandSimEdge glitch = { t + config.pulseWidthUs + random() % (config.bitIntervalUs / 2), (uint8_t)(random() & 1) };
+        out[count++] = glitch;
+      }
+
+      int32_t jitter = config.jitterUs ? (int32_t)(random() % (2 * config.jitterUs + 1)) - (int32_t)config.jitterUs : 0;
+      t += config.bitIntervalUs + jitter;
+    }
+
+    endUs = t + config.frameGapUs;
+    return count;
+  }
+};
+
+#endif //WIEGAND_SIM_H
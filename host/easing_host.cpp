@@ -0,0 +1,106 @@
+// The servo easing tables (easing_table.h) against the exact profiles they
+// are generated from. Checks the endpoints, monotonic motion, symmetry and
+// the worst position error, and times one update along each table against
+// the float easing smoothServoMove() used. Needs no Arduino shim.
+
+#include <math.h>
+#include "host_bench.h"
+#include "easing_table.h"
+
+#define MOVE_STEPS 1000000      // Updates per timed move
+#define MOVE_DEGREES 180        // Distance of the timed move
+#define MAX_ERROR_DEGREES 0.05  // Worst table error allowed over a full move
+
+static const char* const profileNames[EASE_PROFILE_COUNT] = {
+    "quadratic", "cubic", "trapezoid", "min-jerk",
+};
+
+// Keeps the computed positions alive, so the loops are not optimized away
+static volatile int sink;
+
+// The float path smoothServoMove() ran for every step
+static uint64_t timeFloatSteps() {
+    int distance = MOVE_DEGREES;
+    int sum = 0;
+
+    uint64_t start = hostNanos();
+    for (int i = 0; i <= MOVE_STEPS; i++) {
+        float t = i / (float)MOVE_STEPS;
+        float easeFactor;
+        if (t < 0.5) {
+            easeFactor = 2 * t * t;
+        } else {
+            t = t - 1;
+            easeFactor = 1 - (2 * t * t);
+        }
+        sum += (int)(distance * easeFactor);
+    }
+    uint64_t nanos = hostNanos() - start;
+
+    sink = sum;
+    return nanos;
+}
+
+// The integer path ServoTrajectory::tick() runs, same number of steps
+static uint64_t timeTableSteps(EasingProfile profile) {
+    int32_t distance = MOVE_DEGREES;
+    uint32_t timeScale = (uint32_t)((1ULL << 32) / MOVE_STEPS);
+    int sum = 0;
+
+    uint64_t start = hostNanos();
+    for (uint32_t i = 0; i <= MOVE_STEPS; i++) {
+        uint32_t t = (uint32_t)(((uint64_t)i * timeScale) >> 16);
+        sum += (distance * easeFixed(profile, t) + 32768) >> 16;
+    }
+    uint64_t nanos = hostNanos() - start;
+
+    sink = sum;
+    return nanos;
+}
+
+// Walk every Q16 time of the move and check the table against the exact profile.
+// Returns the worst error in degrees.
+static double checkProfile(EasingProfile profile) {
+    const char* name = profileNames[profile];
+    double worst = 0;
+    uint16_t previous = 0;
+    uint32_t backwards = 0;     // Times at which the position decreases
+    uint32_t asymmetric = 0;    // Times not mirrored around the middle of the move
+
+    HOST_CHECK(easeFixed(profile, 0) == 0, "%s does not start at 0", name);
+    HOST_CHECK(easeFixed(profile, EASING_ONE) == 65535, "%s does not end at 65535", name);
+
+    for (uint32_t t = 0; t <= EASING_ONE; t++) {
+        uint16_t position = easeFixed(profile, t);
+        if (position < previous) backwards++;
+        previous = position;
+
+        double error = fabs(position / 65535.0 - easeExact(profile, t / (double)EASING_ONE));
+        if (error > worst) worst = error;
+
+        int mirrored = easeFixed(profile, EASING_ONE - t);
+        if (abs(position + mirrored - 65535) > 2) asymmetric++;
+    }
+
+    HOST_CHECK(backwards == 0, "%s moves backwards at %u times", name, backwards);
+    HOST_CHECK(asymmetric == 0, "%s is not symmetric at %u times", name, asymmetric);
+    double worstDegrees = worst * MOVE_DEGREES;
+    HOST_CHECK(worstDegrees <= MAX_ERROR_DEGREES, "%s is off by %.3f degrees", name, worstDegrees);
+    return worstDegrees;
+}
+
+int main() {
+    printf("Servo easing (one update per step, %d steps over %d degrees)\n", MOVE_STEPS, MOVE_DEGREES);
+    printf("path              ns/step  worst error deg\n");
+
+    uint64_t floatNanos = timeFloatSteps();
+    printf("float quadratic   %7.2f %16s\n", (double)floatNanos / (MOVE_STEPS + 1), "-");
+
+    for (int p = 0; p < EASE_PROFILE_COUNT; p++) {
+        double error = checkProfile((EasingProfile)p);
+        uint64_t nanos = timeTableSteps((EasingProfile)p);
+        printf("table %-11s %7.2f %16.4f\n", profileNames[p], (double)nanos / (MOVE_STEPS + 1), error);
+    }
+
+    return hostTestResult();
+}
@@ -0,0 +1,182 @@
+// Synthetic FDX-B module output (fdxb_stream_sim.h) through the UART receive
+// path - driver ring and pattern detection (shim), RX task and line queue
+// (rfid_uart.cpp) - and decodeFdxbLine(). Checks every valid line decodes to
+// the tag that was sent and nothing else decodes, and reports throughput and
+// per-line latency from the terminator arriving to the tag being decoded.
+
+#include "host_bench.h"
+#include "fdxb_stream_sim.h"
+#include "rfid_uart.h"
+
+#define SIM_LINES 2000          // Lines replayed per scenario
+#define LINE_WAIT_MS 50         // A sent line must come out of the queue within this
+#define BURST_LINES RFID_LINE_QUEUE  // Lines sent back to back before draining, the queue holds all of them
+
+typedef struct {
+    const char* name;
+    FdxbStreamConfig config;
+} Scenario;
+
+static const Scenario scenarios[] = {
+    // name           crlf   raw%  garbage%  oversized%  badCrc%  chunk
+    { "clean",       { false, 0,    0,        0,          0,       0 } },
+    { "cr lf",       { true,  0,    0,        0,          0,       0 } },
+    { "raw hex",     { false, 100,  0,        0,          0,       0 } },
+    { "split",       { true,  50,   0,        0,          0,       7 } },
+    { "garbage 20%", { true,  50,   20,       0,          0,       0 } },
+    { "oversized",   { true,  0,    0,        20,         0,       0 } },
+    { "bad crc 20%", { false, 100,  0,        0,          20,      0 } },
+};
+
+typedef struct {
+    uint32_t lines;
+    uint32_t decoded;        // Decoded to the tag that was sent
+    uint32_t rejected;       // Invalid lines correctly refused
+    uint32_t misdecoded;     // Wrong tag, a tag from an invalid line, or an extra line - must stay 0
+    uint32_t missed;         // Valid lines refused or never received - must stay 0
+    LatencyStats decode;     // decodeFdxbLine() alone
+    LatencyStats latency;    // Terminator received -> tag decoded
+    uint64_t wallNanos;
+} Result;
+
+// Hand the line to the UART, in random chunks if the scenario asks for it.
+// Returns when the last chunk, with the terminator, arrived.
+static uint64_t receiveLine(FdxbStreamSim& sim, const FdxbStreamConfig& config, const char* data, int length) {
+    int received = 0;
+    uint64_t lastChunk = 0;
+    while (received < length) {
+        int chunk = config.maxChunk ? 1 + sim.random() % config.maxChunk : length;
+        if (chunk > length - received) chunk = length - received;
+        lastChunk = hostNanos();
+        hostUartReceive(RFID_UART_PORT, data + received, chunk);
+        received += chunk;
+    }
+    return lastChunk;
+}
+
+// Take the line for one sent line and decode it
+static void takeLine(Result& result, const FdxbTag& expected, bool valid, uint64_t receivedAt) {
+    char line[RFID_LINE_MAX];  // Same size as the front end's line buffer
+    uint32_t endMicros;
+    int lineLength = 0;
+    if (rfidUart.waitForLine(pdMS_TO_TICKS(LINE_WAIT_MS))) {
+        lineLength = rfidUart.readLine(line, sizeof(line), endMicros);
+    }
+    if (lineLength == 0) {
+        if (valid) result.missed++;
+        else result.rejected++;
+        return;
+    }
+
+    FdxbTag tag;
+    uint64_t start = hostNanos();
+    bool decoded = decodeFdxbLine(line, tag);
+    uint64_t end = hostNanos();
+    result.decode.add(end - start);
+    result.latency.add(end - receivedAt);
+
+    if (decoded && (!valid || tag.id != expected.id)) {
+        result.misdecoded++;
+    } else if (decoded) {
+        result.decoded++;
+    } else if (valid) {
+        result.missed++;
+    } else {
+        result.rejected++;
+    }
+}
+
+// One line at a time, each taken before the next is sent
+static void runScenario(const Scenario& scenario, Result& result) {
+    FdxbStreamSim sim(0xC0FFEE);
+    char stream[64];
+    uint64_t start = hostNanos();
+
+    for (uint32_t n = 0; n < SIM_LINES; n++) {
+        FdxbTag expected;
+        bool valid;
+        FdxbLineKind kind = sim.pickKind(scenario.config);
+        int length = sim.generate(kind, scenario.config, stream, sizeof(stream), expected, valid);
+
+        uint64_t receivedAt = receiveLine(sim, scenario.config, stream, length);
+        result.lines++;
+        takeLine(result, expected, valid, receivedAt);
+
+        // Anything else queued for this one line is unexpected
+        char line[RFID_LINE_MAX];
+        uint32_t endMicros;
+        while (rfidUart.readLine(line, sizeof(line), endMicros) > 0) {
+            result.misdecoded++;
+        }
+    }
+    result.wallNanos = hostNanos() - start;
+}
+
+// Bursts of lines that fill the line queue while loop() is busy, then drained
+static void runBursts(Result& result) {
+    static const FdxbStreamConfig config = { true, 50, 0, 0, 0, 0 };
+    FdxbStreamSim sim(0xBEEF);
+    char stream[64];
+    FdxbTag expected[BURST_LINES];
+    uint64_t receivedAt[BURST_LINES];
+    uint64_t start = hostNanos();
+
+    for (uint32_t burst = 0; burst < SIM_LINES / BURST_LINES; burst++) {
+        for (int i = 0; i < BURST_LINES; i++) {
+            bool valid;
+            int length = sim.generate(sim.pickKind(config), config, stream, sizeof(stream), expected[i], valid);
+            receivedAt[i] = receiveLine(sim, config, stream, length);
+        }
+        for (int i = 0; i < BURST_LINES; i++) {
+            result.lines++;
+            takeLine(result, expected[i], true, receivedAt[i]);
+        }
+    }
+    result.wallNanos = hostNanos() - start;
+}
+
+static void report(const char* name, Result& result) {
+    printf("%-12s %6u %5.1f %9u %7u %11u %9.2f %9.0f %9.1f %8.1f %9.1f\n",
+           name,
+           result.lines,
+           100.0 * result.decoded / result.lines,
+           result.rejected,
+           result.missed,
+           result.misdecoded,
+           result.decode.meanUs(),
+           result.lines * 1e9 / result.wallNanos,
+           result.latency.meanUs(),
+           result.latency.percentileUs(0.99),
+           result.latency.worstUs());
+
+    HOST_CHECK(result.misdecoded == 0, "%s: %u lines decoded to a wrong or unexpected tag", name, result.misdecoded);
+    HOST_CHECK(result.missed == 0, "%s: %u valid lines not decoded", name, result.missed);
+}
+
+int main() {
+    if (!rfidUart.begin(0, 1)) {
+        printf("UART driver failed to start\n");
+        return 1;
+    }
+
+    printf("FDX-B receive path (synthetic byte streams, %d lines per scenario)\n", SIM_LINES);
+    printf("scenario      lines   ok%%  rejected  missed  misdecoded  decode us   lines/s  latency us  p99 us  worst us\n");
+
+    for (const Scenario& scenario : scenarios) {
+        Result result = {};
+        runScenario(scenario, result);
+        report(scenario.name, result);
+    }
+
+    Result burst = {};
+    runBursts(burst);
+    report("bursts", burst);
+
+    const RfidUartStats& stats = rfidUart.getStats();
+    printf("UART: %u lines, %u dropped, %u overflows\n",
+           stats.lines, stats.droppedLines, stats.fifoOverflows + stats.bufferOverflows);
+    HOST_CHECK(stats.droppedLines == 0 && stats.fifoOverflows == 0 && stats.bufferOverflows == 0,
+               "receive path lost lines");
+
+    return hostTestResult();
+}
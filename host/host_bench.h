@@ -0,0 +1,74 @@
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+// Shared by the host tests: a monotonic clock, latency statistics, and
+// checks that count failures without stopping the run. A test prints its
+// tables, then returns hostTestResult() from main() for ctest.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+static inline uint64_t hostNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Per-item latencies of one run, in nanoseconds
+class LatencyStats {
+private:
+    std::vector<uint64_t> samples;
+    uint64_t total;
+
+public:
+    LatencyStats() : total(0) {}
+
+    void add(uint64_t nanos) {
+        samples.push_back(nanos);
+        total += nanos;
+    }
+
+    size_t count() const { return samples.size(); }
+    double meanUs() const { return samples.empty() ? 0 : total / 1000.0 / samples.size(); }
+    double totalSeconds() const { return total / 1e9; }
+
+    // Items per second, at the mean latency
+    double perSecond() const { return total > 0 ? samples.size() * 1e9 / total : 0; }
+
+    // Latency below which share (0..1) of the items finished
+    double percentileUs(double share) {
+        if (samples.empty()) return 0;
+        size_t rank = (size_t)(share * (samples.size() - 1) + 0.5);
+        std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+        return samples[rank] / 1000.0;
+    }
+
+    double worstUs() const {
+        return samples.empty() ? 0 : *std::max_element(samples.begin(), samples.end()) / 1000.0;
+    }
+};
+
+inline int hostFailures = 0;
+
+#define HOST_CHECK(condition, ...)                                      \
+    do {                                                                \
+        if (!(condition)) {                                             \
+            hostFailures++;                                             \
+            printf("FAIL %s:%d: %s - ", __FILE__, __LINE__, #condition); \
+            printf(__VA_ARGS__);                                        \
+            printf("\n");                                               \
+        }                                                               \
+    } while (0)
+
+static inline int hostTestResult() {
+    if (hostFailures > 0) {
+        printf("%d check(s) failed\n", hostFailures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
+
+#endif //HOST_BENCH_H
@@ -0,0 +1,90 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host stand-in for the Arduino core, only as much of it as the feeder files
+// built by the host tests use. Nothing here touches hardware: pins and
+// interrupts are accepted and ignored, time comes from the host clock.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "freertos/FreeRTOS.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define IRAM_ATTR
+#define ARDUINO_ISR_ATTR
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define DEC 10
+#define HEX 16
+
+// Critical sections: the host tests drive each module from one thread
+typedef struct {
+    int owner;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portMUX_INITIALIZE(mux) ((mux)->owner = 0)
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux) ((void)(mux))
+#define portENTER_CRITICAL_SAFE(mux) ((void)(mux))
+#define portEXIT_CRITICAL_SAFE(mux) ((void)(mux))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t interrupt, void (*isr)(), int mode);
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline int digitalPinToGPIONumber(int pin) { return pin; }
+
+// Serial output goes to stdout
+class HostSerial {
+private:
+    void printNumber(unsigned long long value, bool negative, int base);
+
+public:
+    void print(const char* text);
+    void print(char c);
+    void print(int value, int base = DEC) { print((long long)value, base); }
+    void print(unsigned int value, int base = DEC) { print((unsigned long long)value, base); }
+    void print(long value, int base = DEC) { print((long long)value, base); }
+    void print(unsigned long value, int base = DEC) { print((unsigned long long)value, base); }
+    void print(long long value, int base = DEC);
+    void print(unsigned long long value, int base = DEC);
+    void print(double value, int digits = 2);
+
+    template <typename T>
+    void println(T value) { print(value); print('\n'); }
+    template <typename T>
+    void println(T value, int format) { print(value, format); print('\n'); }
+    void println() { print('\n'); }
+};
+
+extern HostSerial Serial;
+
+// The cycle counter runs at 1GHz, one cycle per nanosecond of host time
+class HostEsp {
+public:
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 1000; }
+};
+
+extern HostEsp ESP;
+
+#endif //HOST_ARDUINO_H
@@ -0,0 +1,72 @@
+#ifndef HOST_DRIVER_UART_H
+#define HOST_DRIVER_UART_H
+
+// Host stand-in for the ESP-IDF UART driver: an RX ring with pattern
+// detection and an event queue, as much of the driver as rfid_uart.cpp uses.
+// Bytes arrive through hostUartReceive() instead of a pin. Every pattern
+// character queues its position and posts UART_PATTERN_DET, a full ring
+// posts UART_BUFFER_FULL and drops the rest of the bytes.
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef int uart_port_t;
+#define UART_NUM_0 0
+#define UART_NUM_1 1
+#define UART_NUM_2 2
+#define UART_NUM_MAX 3
+
+#define UART_PIN_NO_CHANGE (-1)
+
+typedef enum { UART_DATA_5_BITS, UART_DATA_6_BITS, UART_DATA_7_BITS, UART_DATA_8_BITS } uart_word_length_t;
+typedef enum { UART_PARITY_DISABLE, UART_PARITY_EVEN = 2, UART_PARITY_ODD = 3 } uart_parity_t;
+typedef enum { UART_STOP_BITS_1 = 1, UART_STOP_BITS_1_5, UART_STOP_BITS_2 } uart_stop_bits_t;
+typedef enum { UART_HW_FLOWCTRL_DISABLE } uart_hw_flowcontrol_t;
+typedef enum { UART_SCLK_DEFAULT } uart_sclk_t;
+
+typedef struct {
+    int baud_rate;
+    uart_word_length_t data_bits;
+    uart_parity_t parity;
+    uart_stop_bits_t stop_bits;
+    uart_hw_flowcontrol_t flow_ctrl;
+    uint8_t rx_flow_ctrl_thresh;
+    uart_sclk_t source_clk;
+} uart_config_t;
+
+typedef enum {
+    UART_DATA,
+    UART_BREAK,
+    UART_BUFFER_FULL,
+    UART_FIFO_OVF,
+    UART_FRAME_ERR,
+    UART_PARITY_ERR,
+    UART_DATA_BREAK,
+    UART_PATTERN_DET,
+    UART_EVENT_MAX
+} uart_event_type_t;
+
+typedef struct {
+    uart_event_type_t type;
+    size_t size;
+    bool timeout_flag;
+} uart_event_t;
+
+esp_err_t uart_driver_install(uart_port_t port, int rxBufferSize, int txBufferSize, int queueSize,
+                              QueueHandle_t* queue, int intrFlags);
+esp_err_t uart_param_config(uart_port_t port, const uart_config_t* config);
+esp_err_t uart_set_pin(uart_port_t port, int txPin, int rxPin, int rtsPin, int ctsPin);
+esp_err_t uart_enable_pattern_det_baud_intr(uart_port_t port, char patternChar, uint8_t count,
+                                            int gap, int preIdle, int postIdle);
+esp_err_t uart_pattern_queue_reset(uart_port_t port, int queueLength);
+int uart_pattern_pop_pos(uart_port_t port);
+esp_err_t uart_get_buffered_data_len(uart_port_t port, size_t* size);
+int uart_read_bytes(uart_port_t port, void* buffer, uint32_t length, TickType_t wait);
+esp_err_t uart_flush_input(uart_port_t port);
+
+// Host only: bytes arriving on the RX pin of an installed port
+void hostUartReceive(uart_port_t port, const char* data, int length);
+
+#endif //HOST_DRIVER_UART_H
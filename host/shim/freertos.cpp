@@ -0,0 +1,79 @@
+#include "freertos/FreeRTOS.h"
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct QueueDefinition {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t> > items;
+    size_t length;
+    size_t itemSize;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    QueueDefinition* queue = new QueueDefinition();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+// Wait until ready() holds or the ticks run out, with the queue locked
+template <typename Ready>
+static bool waitFor(QueueHandle_t queue, std::unique_lock<std::mutex>& lock, TickType_t wait, Ready ready) {
+    if (wait == portMAX_DELAY) {
+        queue->changed.wait(lock, ready);
+        return true;
+    }
+    return queue->changed.wait_for(lock, std::chrono::milliseconds(wait), ready);
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!waitFor(queue, lock, wait, [queue] { return queue->items.size() < queue->length; })) {
+        return pdFALSE;
+    }
+    const uint8_t* bytes = (const uint8_t*)item;
+    queue->items.push_back(std::vector<uint8_t>(bytes, bytes + queue->itemSize));
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+static BaseType_t take(QueueHandle_t queue, void* item, TickType_t wait, bool remove) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!waitFor(queue, lock, wait, [queue] { return !queue->items.empty(); })) {
+        return pdFALSE;
+    }
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    if (remove) {
+        queue->items.pop_front();
+        queue->changed.notify_all();
+    }
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait) {
+    return take(queue, item, wait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void* item, TickType_t wait) {
+    return take(queue, item, wait, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return queue->items.size();
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char*, uint32_t, void* arg,
+                                   UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+    std::thread(task, arg).detach();
+    if (handle != NULL) {
+        *handle = NULL;
+    }
+    return pdPASS;
+}
@@ -0,0 +1,128 @@
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <soc/gpio_struct.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+HostSerial Serial;
+HostEsp ESP;
+volatile gpio_dev_t GPIO;
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+static uint64_t elapsedNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long millis() {
+    return (unsigned long)(elapsedNanos() / 1000000);
+}
+
+unsigned long micros() {
+    return (unsigned long)(elapsedNanos() / 1000);
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+uint32_t HostEsp::getCycleCount() {
+    return (uint32_t)elapsedNanos();
+}
+
+void pinMode(uint8_t, uint8_t) {
+}
+
+void digitalWrite(uint8_t, uint8_t) {
+}
+
+int digitalRead(uint8_t) {
+    return HIGH;
+}
+
+void attachInterrupt(uint8_t, void (*)(), int) {
+}
+
+void HostSerial::print(const char* text) {
+    fputs(text, stdout);
+}
+
+void HostSerial::print(char c) {
+    fputc(c, stdout);
+}
+
+void HostSerial::printNumber(unsigned long long value, bool negative, int base) {
+    char digits[66];
+    int length = 0;
+    do {
+        int digit = value % base;
+        digits[length++] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        value /= base;
+    } while (value > 0);
+    if (negative) {
+        digits[length++] = '-';
+    }
+    while (length > 0) {
+        fputc(digits[--length], stdout);
+    }
+}
+
+void HostSerial::print(long long value, int base) {
+    if (base == DEC && value < 0) {
+        printNumber(0ULL - (unsigned long long)value, true, base);
+    } else {
+        printNumber((unsigned long long)value, false, base);
+    }
+}
+
+void HostSerial::print(unsigned long long value, int base) {
+    printNumber(value, false, base);
+}
+
+void HostSerial::print(double value, int digits) {
+    printf("%.*f", digits, value);
+}
+
+// Timers only fire through hostFireTimers()
+struct esp_timer {
+    esp_timer_create_args_t args;
+    bool pending;    // One-shot started and not yet fired or stopped
+};
+
+static std::vector<esp_timer_handle_t> timers;
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* handle) {
+    *handle = new esp_timer{ *args, false };
+    timers.push_back(*handle);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t) {
+    if (timer == NULL) return ESP_ERR_INVALID_ARG;
+    timer->pending = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t, uint64_t) {
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (timer == NULL) return ESP_ERR_INVALID_ARG;
+    timer->pending = false;
+    return ESP_OK;
+}
+
+int64_t esp_timer_get_time() {
+    return (int64_t)(elapsedNanos() / 1000);
+}
+
+void hostFireTimers() {
+    for (esp_timer_handle_t timer : timers) {
+        if (timer->pending) {
+            timer->pending = false;
+            timer->args.callback(timer->args.arg);
+        }
+    }
+}
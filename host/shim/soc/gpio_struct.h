@@ -0,0 +1,29 @@
+#ifndef HOST_SOC_GPIO_STRUCT_H
+#define HOST_SOC_GPIO_STRUCT_H
+
+// Host stand-in for the GPIO registers, plain memory the tests can inspect
+
+#include <stdint.h>
+
+typedef struct {
+    uint32_t out;
+    uint32_t out_w1ts;
+    uint32_t out_w1tc;
+    union {
+        struct {
+            uint32_t data : 22;
+        };
+        uint32_t val;
+    } out1, out1_w1ts, out1_w1tc;
+    uint32_t in;
+    union {
+        struct {
+            uint32_t data : 22;
+        };
+        uint32_t val;
+    } in1;
+} gpio_dev_t;
+
+extern volatile gpio_dev_t GPIO;
+
+#endif //HOST_SOC_GPIO_STRUCT_H
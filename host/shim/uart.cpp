@@ -0,0 +1,143 @@
+#include "driver/uart.h"
+#include <deque>
+#include <mutex>
+
+struct HostUart {
+    std::mutex mutex;
+    bool installed;
+    size_t bufferSize;
+    QueueHandle_t events;
+    std::deque<uint8_t> rx;
+    uint64_t received;            // Bytes ever stored in rx
+    uint64_t consumed;            // Bytes ever taken out of rx
+    int pattern;                  // Pattern character, -1 while detection is off
+    std::deque<uint64_t> patternPositions;  // Stream positions of detected patterns
+    size_t patternQueueLength;
+};
+
+static HostUart uarts[UART_NUM_MAX];
+
+static HostUart* uartFor(uart_port_t port) {
+    return port >= 0 && port < UART_NUM_MAX && uarts[port].installed ? &uarts[port] : NULL;
+}
+
+static void postEvent(HostUart* uart, uart_event_type_t type, size_t size) {
+    uart_event_t event = {};
+    event.type = type;
+    event.size = size;
+    xQueueSend(uart->events, &event, 0); // Lost if the queue is full, as in the driver
+}
+
+esp_err_t uart_driver_install(uart_port_t port, int rxBufferSize, int, int queueSize,
+                              QueueHandle_t* queue, int) {
+    if (port < 0 || port >= UART_NUM_MAX || uarts[port].installed) {
+        return ESP_FAIL;
+    }
+    HostUart& uart = uarts[port];
+    uart.installed = true;
+    uart.bufferSize = rxBufferSize;
+    uart.events = xQueueCreate(queueSize, sizeof(uart_event_t));
+    uart.received = 0;
+    uart.consumed = 0;
+    uart.pattern = -1;
+    uart.patternQueueLength = 0;
+    *queue = uart.events;
+    return ESP_OK;
+}
+
+esp_err_t uart_param_config(uart_port_t port, const uart_config_t*) {
+    return uartFor(port) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t uart_set_pin(uart_port_t port, int, int, int, int) {
+    return uartFor(port) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t uart_enable_pattern_det_baud_intr(uart_port_t port, char patternChar, uint8_t, int, int, int) {
+    HostUart* uart = uartFor(port);
+    if (uart == NULL) return ESP_FAIL;
+    std::lock_guard<std::mutex> lock(uart->mutex);
+    uart->pattern = (uint8_t)patternChar;
+    return ESP_OK;
+}
+
+esp_err_t uart_pattern_queue_reset(uart_port_t port, int queueLength) {
+    HostUart* uart = uartFor(port);
+    if (uart == NULL) return ESP_FAIL;
+    std::lock_guard<std::mutex> lock(uart->mutex);
+    uart->patternPositions.clear();
+    uart->patternQueueLength = queueLength;
+    return ESP_OK;
+}
+
+// Position of the oldest pattern relative to the next byte read, -1 if none is queued
+int uart_pattern_pop_pos(uart_port_t port) {
+    HostUart* uart = uartFor(port);
+    if (uart == NULL) return -1;
+    std::lock_guard<std::mutex> lock(uart->mutex);
+    while (!uart->patternPositions.empty() && uart->patternPositions.front() < uart->consumed) {
+        uart->patternPositions.pop_front(); // Already read past
+    }
+    if (uart->patternPositions.empty()) {
+        return -1;
+    }
+    int position = (int)(uart->patternPositions.front() - uart->consumed);
+    uart->patternPositions.pop_front();
+    return position;
+}
+
+esp_err_t uart_get_buffered_data_len(uart_port_t port, size_t* size) {
+    HostUart* uart = uartFor(port);
+    if (uart == NULL) return ESP_FAIL;
+    std::lock_guard<std::mutex> lock(uart->mutex);
+    *size = uart->rx.size();
+    return ESP_OK;
+}
+
+// Never waits, the feeder only reads bytes it knows are buffered
+int uart_read_bytes(uart_port_t port, void* buffer, uint32_t length, TickType_t) {
+    HostUart* uart = uartFor(port);
+    if (uart == NULL) return -1;
+    std::lock_guard<std::mutex> lock(uart->mutex);
+    uint32_t count = length < uart->rx.size() ? length : uart->rx.size();
+    for (uint32_t i = 0; i < count; i++) {
+        ((uint8_t*)buffer)[i] = uart->rx.front();
+        uart->rx.pop_front();
+    }
+    uart->consumed += count;
+    return count;
+}
+
+esp_err_t uart_flush_input(uart_port_t port) {
+    HostUart* uart = uartFor(port);
+    if (uart == NULL) return ESP_FAIL;
+    std::lock_guard<std::mutex> lock(uart->mutex);
+    uart->consumed += uart->rx.size();
+    uart->rx.clear();
+    return ESP_OK;
+}
+
+void hostUartReceive(uart_port_t port, const char* data, int length) {
+    HostUart* uart = uartFor(port);
+    if (uart == NULL) return;
+
+    for (int i = 0; i < length; i++) {
+        std::unique_lock<std::mutex> lock(uart->mutex);
+        if (uart->rx.size() >= uart->bufferSize) {
+            lock.unlock();
+            postEvent(uart, UART_BUFFER_FULL, 0);
+            return;
+        }
+        uart->rx.push_back((uint8_t)data[i]);
+        uart->received++;
+
+        if ((uint8_t)data[i] != uart->pattern) {
+            continue;
+        }
+        if (uart->patternPositions.size() < uart->patternQueueLength) {
+            uart->patternPositions.push_back(uart->received - 1);
+        }
+        lock.unlock();
+        postEvent(uart, UART_PATTERN_DET, 0);
+    }
+}
@@ -0,0 +1,238 @@
+// The integer step ramp (step_ramp.h) against the motion it stands for.
+// Checks that a move takes exactly the steps asked for and never exceeds the
+// cruise speed, that stop() decelerates over the ramp already climbed, and
+// that the trapezoid keeps the timing of constant acceleration. Reports the
+// cost of one interval, against AccelStepper's floating point ramp, and the
+// move times. Needs no Arduino shim.
+
+#include <math.h>
+#include <vector>
+#include "host_bench.h"
+#include "step_ramp.h"
+
+#define TICK_HZ 1000000          // Step timer resolution, as STEP_TIMER_HZ
+#define SPEED 4000               // steps/s
+#define ACCELERATION 8000        // steps/s^2
+#define TIMED_STEPS 4000         // Length of the timed move
+#define TIMED_MOVES 200
+#define MAX_TIMING_ERROR 0.01    // Trapezoid intervals against the exact ones, past the first few
+#define MAX_MOVE_ERROR 0.02      // Timed move and ramp length against the exact ones
+
+static const char* const shapeNames[] = { "trapezoid", "s-curve" };
+
+// Intervals of a whole move, the first step is taken without one
+template <typename Ramp>
+static std::vector<uint32_t> runMove(Ramp& ramp, uint32_t steps) {
+    std::vector<uint32_t> intervals;
+    ramp.start(steps);
+    uint32_t interval;
+    while ((interval = ramp.next()) != 0) {
+        intervals.push_back(interval);
+    }
+    return intervals;
+}
+
+static double moveSeconds(const std::vector<uint32_t>& intervals) {
+    double ticks = 0;
+    for (uint32_t interval : intervals) ticks += interval;
+    return ticks / TICK_HZ;
+}
+
+// AccelStepper::computeNewSpeed() for a move from standstill, as run() calls
+// it after every step. Its double math runs in software on the ESP32, here on
+// the host FPU, so the gap to the integer ramp is wider on the board.
+struct AccelStepperRamp {
+    double c0, cmin, cn, speed, acceleration;
+    long n, distance;
+
+    AccelStepperRamp(double maxSpeed, double accel)
+        : c0(0.676 * sqrt(2.0 / accel) * TICK_HZ), cmin(TICK_HZ / maxSpeed), cn(0), speed(0),
+          acceleration(accel), n(0), distance(0) {}
+
+    void start(long steps) {
+        distance = steps;
+        speed = 0;
+        n = 0;
+    }
+
+    uint32_t next() {
+        distance--;
+        long stepsToStop = (long)((speed * speed) / (2.0 * acceleration));
+        if (distance == 0 && stepsToStop <= 1) {
+            return 0;
+        }
+        if (n > 0 && stepsToStop >= distance) {
+            n = -stepsToStop;
+        } else if (n < 0 && stepsToStop < distance) {
+            n = -n;
+        }
+        if (n == 0) {
+            cn = c0;
+        } else {
+            cn = cn - (2.0 * cn) / (4.0 * n + 1);
+            if (cn < cmin) cn = cmin;
+        }
+        n++;
+        speed = TICK_HZ / cn;
+        return (uint32_t)cn;
+    }
+};
+
+// Nanoseconds per interval over TIMED_MOVES moves of steps
+template <typename Ramp>
+static double timeIntervals(Ramp& ramp, uint32_t steps) {
+    uint64_t sum = 0;
+    uint64_t start = hostNanos();
+    for (int move = 0; move < TIMED_MOVES; move++) {
+        ramp.start(steps);
+        uint32_t interval;
+        while ((interval = ramp.next()) != 0) {
+            sum += interval;
+        }
+    }
+    uint64_t nanos = hostNanos() - start;
+    if (sum == 0) printf("no intervals\n"); // Keeps the timed loop
+    return (double)nanos / TIMED_MOVES / steps;
+}
+
+// Exact time from the first step to the last of a move from standstill to
+// standstill. The first step is taken when the move starts, the exact motion
+// takes it once it has covered one step.
+static double exactSeconds(RampShape shape, double steps) {
+    // The S-curve ramp takes 1.5 times as long at the same peak acceleration
+    double rampSeconds = (shape == RAMP_S_CURVE ? 1.5 : 1.0) * SPEED / ACCELERATION;
+    double rampSteps = SPEED * rampSeconds / 2;
+
+    // Time share of the ramp that covers a share of its distance
+    auto rampTime = [shape](double distance) {
+        return shape == RAMP_S_CURVE ? sCurveTimeAt(distance, 0, 1, 40) : sqrt(distance);
+    };
+    double firstStep = rampSeconds * rampTime(1 / rampSteps);
+    if (2 * rampSteps > steps) {
+        // Never reaches cruise speed, the ramp down starts half way
+        return 2 * rampSeconds * rampTime(steps / (2 * rampSteps)) - firstStep;
+    }
+    return 2 * rampSeconds + (steps - 2 * rampSteps) / SPEED - firstStep;
+}
+
+static void checkStepCounts(RampShape shape) {
+    StepRamp ramp;
+    ramp.configure(SPEED, ACCELERATION, shape, TICK_HZ);
+    uint32_t cruiseTicks = TICK_HZ / SPEED;
+
+    for (uint32_t steps : { 1u, 2u, 3u, 10u, 200u, 1000u, 5000u, 20000u }) {
+        std::vector<uint32_t> intervals = runMove(ramp, steps);
+        HOST_CHECK(intervals.size() + 1 == steps, "%s: %u steps asked, %zu taken",
+                   shapeNames[shape], steps, intervals.size() + 1);
+
+        uint32_t fastest = ~0u;
+        for (uint32_t interval : intervals) {
+            if (interval < fastest) fastest = interval;
+        }
+        HOST_CHECK(intervals.empty() || fastest >= cruiseTicks, "%s: %u steps ran at %u ticks, faster than cruise",
+                   shapeNames[shape], steps, fastest);
+    }
+}
+
+static void checkStop(RampShape shape) {
+    StepRamp ramp;
+    ramp.configure(SPEED, ACCELERATION, shape, TICK_HZ);
+
+    // Stopped before the first step: nothing to take
+    ramp.start(100);
+    ramp.stop();
+    HOST_CHECK(ramp.isDone(), "%s: stop() before the first step left steps to take", shapeNames[shape]);
+
+    // Stopped while accelerating and while cruising: the ramp down mirrors the ramp up
+    for (uint32_t stopAfter : { 50u, 500u, 3000u }) {
+        ramp.start(20000);
+        std::vector<uint32_t> up;
+        for (uint32_t i = 0; i < stopAfter; i++) {
+            up.push_back(ramp.next());
+        }
+        uint32_t climbed = ramp.rampPosition();
+        ramp.stop();
+        HOST_CHECK(ramp.stepsRemaining() == climbed, "%s: stopped at ramp position %u with %u steps left",
+                   shapeNames[shape], climbed, ramp.stepsRemaining());
+
+        std::vector<uint32_t> down;
+        uint32_t interval;
+        while ((interval = ramp.next()) != 0) {
+            down.push_back(interval);
+        }
+        HOST_CHECK(down.size() + 1 == climbed, "%s: decelerated over %zu steps, climbed %u",
+                   shapeNames[shape], down.size() + 1, climbed);
+
+        bool slowing = true;
+        for (size_t i = 1; i < down.size(); i++) {
+            slowing = slowing && down[i] >= down[i - 1];
+        }
+        HOST_CHECK(slowing, "%s: sped up while stopping after %u steps", shapeNames[shape], stopAfter);
+    }
+}
+
+// Constant acceleration from standstill reaches step k at sqrt(2k / a). The
+// recurrence departs from that on its first few steps (Austin's correction
+// only shortens the first), then should step at those times until it reaches
+// the cruise speed about v^2 / 2a steps in.
+static void checkTrapezoidTiming() {
+    StepRamp ramp;
+    ramp.configure(SPEED, ACCELERATION, RAMP_TRAPEZOID, TICK_HZ);
+    ramp.start(100000);
+
+    double worst = 0;
+    uint32_t interval = ramp.next();
+    uint32_t k = ramp.rampPosition();
+    for (;;) {
+        interval = ramp.next();
+        if (ramp.rampPosition() == k) break; // Cruising
+        k = ramp.rampPosition();
+
+        double exact = (sqrt(2.0 * k / ACCELERATION) - sqrt(2.0 * (k - 1) / ACCELERATION)) * TICK_HZ;
+        double error = fabs(interval - exact) / exact;
+        if (k > 10 && error > worst) worst = error;
+    }
+    double rampSteps = (double)SPEED * SPEED / (2 * ACCELERATION);
+    printf("trapezoid: cruising after %u steps (exact %.0f), intervals off by %.3f%% at worst\n",
+           k, rampSteps, worst * 100);
+    HOST_CHECK(worst <= MAX_TIMING_ERROR, "trapezoid intervals are off by %.3f%%", worst * 100);
+    HOST_CHECK(fabs(k - rampSteps) <= MAX_MOVE_ERROR * rampSteps, "trapezoid reached cruise after %u steps, exact %.0f",
+               k, rampSteps);
+    HOST_CHECK(interval == TICK_HZ / SPEED, "trapezoid cruises at %u ticks, exact %u", interval, TICK_HZ / SPEED);
+}
+
+int main() {
+    printf("Step ramp (%d steps/s, %d steps/s^2, %d tick/s)\n", SPEED, ACCELERATION, TICK_HZ);
+
+    for (RampShape shape : { RAMP_TRAPEZOID, RAMP_S_CURVE }) {
+        checkStepCounts(shape);
+        checkStop(shape);
+    }
+    checkTrapezoidTiming();
+
+    printf("shape          steps  move ms  exact ms  ns/step\n");
+    for (RampShape shape : { RAMP_TRAPEZOID, RAMP_S_CURVE }) {
+        StepRamp ramp;
+        ramp.configure(SPEED, ACCELERATION, shape, TICK_HZ);
+
+        for (uint32_t steps : { 200u, (uint32_t)TIMED_STEPS }) {
+            double seconds = moveSeconds(runMove(ramp, steps));
+            double exact = exactSeconds(shape, steps);
+
+            printf("%-12s %7u %8.1f %9.1f %8.2f\n", shapeNames[shape], steps, seconds * 1000, exact * 1000,
+                   timeIntervals(ramp, steps));
+            // Short moves end on the first steps of the ramp, where the integer ramp departs from the exact one
+            HOST_CHECK(steps < TIMED_STEPS || fabs(seconds - exact) / exact <= MAX_MOVE_ERROR,
+                       "%s: %u steps took %.1f ms, exact %.1f ms", shapeNames[shape], steps, seconds * 1000,
+                       exact * 1000);
+        }
+    }
+
+    AccelStepperRamp reference(SPEED, ACCELERATION);
+    for (uint32_t steps : { 200u, (uint32_t)TIMED_STEPS }) {
+        printf("%-12s %7u %8.1f %9.1f %8.2f\n", "AccelStepper", steps, moveSeconds(runMove(reference, steps)) * 1000,
+               exactSeconds(RAMP_TRAPEZOID, steps) * 1000, timeIntervals(reference, steps));
+    }
+
+    return hostTestResult();
+}
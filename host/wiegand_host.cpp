@@ -0,0 +1,262 @@
+// Synthetic Wiegand pulse trains (wiegand_sim.h) through the reader's edge
+// ring and frame assembly (wiegand_reader.cpp) and the format decoders
+// (wiegand_format.h). Reports decode throughput and per-frame latency.
+//
+// The pin ISR path is driven through onEdge() as the falling edge interrupts
+// call it, with the line levels it reads set in the GPIO input register. Every
+// fall must queue exactly one bit, whether or not the line has risen again by
+// the time the ISR runs, and the logic capture must show each pulse once.
+//
+// A clean line must decode every frame to the card that was sent. With bits
+// dropped or added a frame can turn into another format's length (a 35-bit
+// C1000 missing a bit is 34 bits long, like H10306) and pass that format's
+// parity by chance - Wiegand can't catch that. Any other wrong card is a bug.
+
+#include "host_bench.h"
+#include "wiegand_reader.h"
+#include "wiegand_sim.h"
+
+#define SIM_FRAMES 5000    // Simulated frames per scenario
+#define SIM_MAX_EDGES 96
+#define ISR_FRAMES 2000    // Frames through onEdge(), every other one captured
+#define ISR_DATA0 4
+#define ISR_DATA1 5
+
+typedef struct {
+    const char* name;
+    WiegandSimConfig config;
+    bool lossless;         // Every frame must decode
+} Scenario;
+
+static const Scenario scenarios[] = {
+    // name           pulse  interval  jitter  drop  glitch  gap
+    { "clean",       { 50,   2000,     0,      0,    0,      50000 }, true },
+    { "jitter",      { 50,   2000,     400,    0,    0,      50000 }, true },
+    { "fast",        { 20,   200,      20,     0,    0,      50000 }, true },
+    { "drops 1%",    { 50,   2000,     100,    10,   0,      50000 }, false },
+    { "glitches 1%", { 50,   2000,     100,    0,    10,     50000 }, false },
+};
+
+// Never begun, edges are injected as the ISRs would queue them
+static WiegandReader<0xFF, 0xFE> reader(0);
+
+typedef struct {
+    uint32_t frames;
+    uint32_t decoded;      // Decoded to the card that was sent
+    uint32_t rejected;     // Parity or length failure
+    uint32_t misdecoded;   // Accepted but with the wrong card
+    uint32_t sameLength;   // ...from a frame of the length that was sent - must stay 0
+    LatencyStats latency;  // Draining the ring and decoding one frame
+} Result;
+
+// Encode a random card in one of the supported formats
+static uint8_t randomFrame(WiegandPulseSim& sim, uint32_t n, uint64_t& bits, WiegandCard& expected) {
+    uint32_t facility = sim.random();
+    uint32_t card = sim.random();
+    switch (n % 4) {
+        case 0:  bits = encodeWiegandAs<H10301>(facility, card); break;
+        case 1:  bits = encodeWiegandAs<H10306>(facility, card); break;
+        case 2:  bits = encodeWiegandAs<Corporate1000>(facility, card); break;
+        default: bits = encodeWiegandAs<H10304>(facility, card); break;
+    }
+    static const uint8_t lengths[] = { H10301::length, H10306::length, Corporate1000::length, H10304::length };
+    uint8_t bitCount = lengths[n % 4];
+    decodeWiegandFrame(bits, bitCount, expected);
+    return bitCount;
+}
+
+static void runScenario(const Scenario& scenario, Result& result) {
+    WiegandPulseSim sim(0xC0FFEE);
+    WiegandSimEdge edges[SIM_MAX_EDGES];
+    uint32_t clockUs = 0;
+
+    reader.setVerbose(false);
+    reader.reset();
+
+    for (uint32_t n = 0; n < SIM_FRAMES; n++) {
+        uint64_t bits;
+        WiegandCard expected = {};
+        uint8_t bitCount = randomFrame(sim, n, bits, expected);
+
+        uint32_t endUs;
+        int edgeCount = sim.generate(bits, bitCount, scenario.config, clockUs, edges, SIM_MAX_EDGES, endUs);
+        clockUs = endUs;
+
+        // Queue the edges as the ISRs would, closing a frame wherever the
+        // gap timer would have fired
+        for (int i = 0; i < edgeCount; i++) {
+            if (i > 0 && edges[i].timeUs - edges[i - 1].timeUs > WIEGAND_FRAME_GAP_US) {
+                reader.injectFrameEnd();
+            }
+            WiegandEdge edge = { edges[i].timeUs * ESP.getCpuFreqMHz(), edges[i].bit };
+            reader.injectEdge(edge);
+        }
+        reader.injectFrameEnd();
+
+        bool matched = false;
+        bool wrong = false;
+        bool wrongSameLength = false;
+        uint64_t start = hostNanos();
+        while (true) {
+            reader.poll();
+            if (!reader.frameReady()) break;
+
+            WiegandCard card;
+            if (reader.decode(card)) {
+                if (card.bitCount == expected.bitCount && card.id == expected.id) {
+                    matched = true;
+                } else {
+                    wrong = true;
+                    wrongSameLength |= reader.bitCount() == expected.bitCount;
+                }
+            }
+            reader.reset();
+        }
+        result.latency.add(hostNanos() - start);
+
+        result.frames++;
+        if (wrong) {
+            result.misdecoded++;
+            if (wrongSameLength) result.sameLength++;
+        } else if (matched) {
+            result.decoded++;
+        } else {
+            result.rejected++;
+        }
+    }
+}
+
+// A begun reader whose ISR entry point the test can call
+class IsrReader : public WiegandReader<ISR_DATA0, ISR_DATA1> {
+public:
+    explicit IsrReader(uint8_t index) : WiegandReader<ISR_DATA0, ISR_DATA1>(index) {}
+    using WiegandReaderBase::onEdge;
+};
+
+static void setLine(int gpio, bool high) {
+    if (high) {
+        GPIO.in = GPIO.in | (1UL << gpio);
+    } else {
+        GPIO.in = GPIO.in & ~(1UL << gpio);
+    }
+}
+
+// The capture of one frame: per data line, a fall then a rise for every bit
+// sent on it, in time order
+static bool captureMatches(uint8_t firstChannel, uint64_t bits, uint8_t bitCount) {
+    int expected[2] = { 0, 0 };
+    for (uint8_t i = 0; i < bitCount; i++) {
+        expected[(bits >> i) & 1]++;
+    }
+
+    int seen[2] = { 0, 0 };
+    uint32_t lastUs[2] = { 0, 0 };
+    for (uint16_t i = 0; i < logicCapture.size(); i++) {
+        const CaptureSample& sample = logicCapture.sample(i);
+        int line = sample.channel - firstChannel;
+        if (line < 0 || line > 1) return false;
+        if (sample.value != (seen[line] & 1) || (seen[line] > 0 && sample.timeUs < lastUs[line])) return false;
+        lastUs[line] = sample.timeUs;
+        seen[line]++;
+    }
+    return logicCapture.overwritten() == 0 && seen[0] == 2 * expected[0] && seen[1] == 2 * expected[1];
+}
+
+static void checkIsrPath() {
+    static const char* const channels[] = { "reader0_d0", "reader0_d1", "reader1_d0", "reader1_d1" };
+    logicCapture.setChannels(channels, 4, 1);
+
+    IsrReader isrReader(1);
+    isrReader.setVerbose(false);
+    setLine(ISR_DATA0, true);
+    setLine(ISR_DATA1, true);
+    HOST_CHECK(isrReader.begin(), "the ISR reader did not begin");
+
+    WiegandPulseSim sim(0xBEEF);
+    uint32_t decoded = 0;
+    uint32_t badCaptures = 0;
+    uint64_t nanos[2] = { 0, 0 };   // onEdge() with the capture stopped, armed
+    uint32_t calls[2] = { 0, 0 };
+
+    for (uint32_t n = 0; n < ISR_FRAMES; n++) {
+        bool captured = n & 1;
+        if (captured) {
+            logicCapture.start();
+        } else {
+            logicCapture.stop();
+        }
+
+        uint64_t bits;
+        WiegandCard expected = {};
+        uint8_t bitCount = randomFrame(sim, n, bits, expected);
+
+        uint64_t start = hostNanos();
+        for (int i = bitCount - 1; i >= 0; i--) {
+            byte bit = (bits >> i) & 1;
+            int gpio = bit ? ISR_DATA1 : ISR_DATA0;
+            setLine(gpio, false);
+            // Half the pulses are over before the ISR reads the line, as when
+            // the rise lands between the interrupt and the level read
+            if (sim.random() & 1) {
+                setLine(gpio, true);
+            }
+            isrReader.onEdge(bit);
+            setLine(gpio, true);
+        }
+        nanos[captured] += hostNanos() - start;
+        calls[captured] += bitCount;
+        hostFireTimers();   // The frame gap
+
+        isrReader.poll();
+        WiegandCard card;
+        if (isrReader.frameReady() && isrReader.decode(card) && card.bitCount == expected.bitCount &&
+            card.id == expected.id) {
+            decoded++;
+        }
+        isrReader.reset();
+
+        if (captured) {
+            logicCapture.stop();
+            if (!captureMatches(2, bits, bitCount)) badCaptures++;
+        }
+    }
+
+    printf("onEdge(): %u frames, %u decoded, %u bad captures, %.1f ns per edge (capture off), %.1f ns (on)\n",
+           ISR_FRAMES, decoded, badCaptures, (double)nanos[0] / calls[0], (double)nanos[1] / calls[1]);
+    HOST_CHECK(decoded == ISR_FRAMES, "only %u of %u frames through onEdge() decoded", decoded, ISR_FRAMES);
+    HOST_CHECK(badCaptures == 0, "%u frames captured without one fall and rise per pulse", badCaptures);
+    HOST_CHECK(isrReader.droppedEdges() == 0, "onEdge() dropped %u edges", isrReader.droppedEdges());
+}
+
+int main() {
+    printf("Wiegand decode (synthetic pulse trains, %d frames per scenario)\n", SIM_FRAMES);
+    printf("scenario      frames/s   ok%%  rejected%%  misdecoded  mean us  p99 us  worst us\n");
+
+    for (const Scenario& scenario : scenarios) {
+        Result result = {};
+        runScenario(scenario, result);
+
+        printf("%-12s %9.0f %6.1f %10.1f %11u %8.2f %7.2f %9.2f\n",
+               scenario.name,
+               result.latency.perSecond(),
+               100.0 * result.decoded / result.frames,
+               100.0 * result.rejected / result.frames,
+               result.misdecoded,
+               result.latency.meanUs(),
+               result.latency.percentileUs(0.99),
+               result.latency.worstUs());
+
+        HOST_CHECK(result.sameLength == 0, "%s: %u frames of the sent length decoded to the wrong card",
+                   scenario.name, result.sameLength);
+        if (scenario.lossless) {
+            HOST_CHECK(result.misdecoded == 0, "%s: %u frames decoded to the wrong card", scenario.name, result.misdecoded);
+            HOST_CHECK(result.decoded == result.frames, "%s: only %u of %u frames decoded",
+                       scenario.name, result.decoded, result.frames);
+        }
+    }
+
+    HOST_CHECK(reader.droppedEdges() == 0, "%u edges dropped", reader.droppedEdges());
+
+    checkIsrPath();
+    return hostTestResult();
+}